@@ -5,11 +5,13 @@
 
 #include "cista/cista.h"
 #include "cntgs/contiguous.hpp"
+#include "cntgs/mmapAllocator.hpp"
 
 #include <benchmark/benchmark.h>
 
 #include <memory_resource>
 #include <random>
+#include <tuple>
 #include <vector>
 
 static constexpr auto MSVC_VECTOR_CONSTRUCTION_OVERHEAD = 16;
@@ -20,9 +22,16 @@ static std::mt19937 gen(rd());
 static std::uniform_real_distribution<float> float_dist(0.f, FLOAT_MAX);
 
 using FixedSizeVector = cntgs::ContiguousVector<cntgs::FixedSize<float>>;
+using HugePageFixedSizeVector =
+    cntgs::BasicContiguousVector<cntgs::Options<cntgs::Allocator<cntgs::MmapAllocator<std::byte>>>,
+                                 cntgs::FixedSize<float>>;
 using TwoFixedSizeVector = cntgs::ContiguousVector<cntgs::FixedSize<float>, float, cntgs::FixedSize<float>>;
-using VaryingSizeVector = cntgs::ContiguousVector<cntgs::VaryingSize<float>>;
-using TwoVaryingSizeVector = cntgs::ContiguousVector<cntgs::VaryingSize<float>, float, cntgs::VaryingSize<float>>;
+using VaryingSizeVector = cntgs::ContiguousVector<std::size_t, cntgs::VaryingSize<float>>;
+using TwoVaryingSizeVector = cntgs::ContiguousVector<std::size_t, cntgs::VaryingSize<float>, float, std::size_t,
+                                                     cntgs::VaryingSize<float>>;
+template <std::size_t Stride>
+using SampledVaryingSizeVector =
+    cntgs::BasicContiguousVector<cntgs::Options<cntgs::SampledIndex<Stride>>, std::size_t, cntgs::VaryingSize<float>>;
 
 struct Cista
 {
@@ -127,6 +136,17 @@ auto iterate(const cntgs::ContiguousVector<T>& vector, size_t)
     }
 }
 
+static auto iterate(const VaryingSizeVector& vector, size_t)
+{
+    for (auto&& [size, elem] : vector)
+    {
+        for (auto&& e : elem)
+        {
+            work(e);
+        }
+    }
+}
+
 template <std::size_t N>
 auto iterate(const std::vector<TwoArray<N, N>>& vector, size_t fixed_size)
 {
@@ -177,6 +197,22 @@ auto iterate(const cntgs::ContiguousVector<T...>& vector, size_t)
     }
 }
 
+static auto iterate(const TwoVaryingSizeVector& vector, size_t)
+{
+    for (auto&& [a_size, a, b, c_size, c] : vector)
+    {
+        for (auto&& e : a)
+        {
+            work(e);
+        }
+        work(b);
+        for (auto&& e : c)
+        {
+            work(e);
+        }
+    }
+}
+
 auto iterate(const CistaVector& vector, size_t)
 {
     for (auto&& [a, b, c] : vector.vector)
@@ -193,12 +229,19 @@ auto iterate(const CistaVector& vector, size_t)
     }
 }
 
+// the floats are the last parameter, preceded by their count in vectors with a VaryingSize parameter
+template <class Reference>
+auto get_floats(const Reference& element)
+{
+    return cntgs::get<std::tuple_size_v<Reference> - 1>(element);
+}
+
 template <class... T>
-auto random_lookup(const cntgs::ContiguousVector<T...>& vector, const std::vector<size_t>& indices)
+auto random_lookup(const cntgs::BasicContiguousVector<T...>& vector, const std::vector<size_t>& indices)
 {
     for (auto&& j : indices)
     {
-        for (auto&& elem : cntgs::get<0>(vector[j]))
+        for (auto&& elem : get_floats(vector[j]))
         {
             work(elem);
         }
@@ -228,6 +271,19 @@ auto random_lookup(const std::vector<std::array<float, N>>& vector, const std::v
     }
 }
 
+template <class... T>
+auto batched_random_lookup(const cntgs::BasicContiguousVector<T...>& vector, const std::vector<size_t>& indices)
+{
+    vector.for_each_index(indices,
+                          [](auto&& element)
+                          {
+                              for (auto&& elem : get_floats(element))
+                              {
+                                  work(elem);
+                              }
+                          });
+}
+
 auto generate_single_element_input(std::size_t elements, std::size_t fixed_size)
 {
     std::vector<std::vector<float>> input{elements};
@@ -271,7 +327,14 @@ void fill_vector(cntgs::BasicContiguousVector<T...>& target, const std::vector<s
 {
     for (const auto& v : source)
     {
-        target.emplace_back(v);
+        if constexpr (std::tuple_size_v<typename cntgs::BasicContiguousVector<T...>::value_type> == 1)
+        {
+            target.emplace_back(v);
+        }
+        else
+        {
+            target.emplace_back(v.size(), v);
+        }
     }
 }
 
@@ -287,8 +350,11 @@ auto make_single_element_input_vectors(std::size_t elements, std::size_t fixed_s
     fill_vector(fixed_size_vector, input);
     VaryingSizeVector varying_size_vector{input.size(), input.size() * fixed_size * sizeof(float)};
     fill_vector(varying_size_vector, input);
-    return std::tuple{std::move(array_vector), std::move(vector_vector), std::move(fixed_size_vector),
-                      std::move(varying_size_vector)};
+    HugePageFixedSizeVector huge_page_fixed_size_vector{input.size(), {fixed_size}};
+    fill_vector(huge_page_fixed_size_vector, input);
+    return std::tuple{std::move(array_vector),        std::move(vector_vector),
+                      std::move(fixed_size_vector),   std::move(varying_size_vector),
+                      std::move(huge_page_fixed_size_vector)};
 }
 
 auto make_varying_size_input_vectors(std::size_t elements, std::size_t variance)
@@ -311,7 +377,12 @@ auto make_varying_size_input_vectors(std::size_t elements, std::size_t variance)
     fill_vector(vector_vector, input);
     VaryingSizeVector varying_size_vector{input.size(), total_size * sizeof(float)};
     fill_vector(varying_size_vector, input);
-    return std::tuple{std::move(vector_vector), std::move(varying_size_vector)};
+    SampledVaryingSizeVector<16> sampled_16_vector{input.size(), total_size * sizeof(float)};
+    fill_vector(sampled_16_vector, input);
+    SampledVaryingSizeVector<64> sampled_64_vector{input.size(), total_size * sizeof(float)};
+    fill_vector(sampled_64_vector, input);
+    return std::tuple{std::move(vector_vector), std::move(varying_size_vector), std::move(sampled_16_vector),
+                      std::move(sampled_64_vector)};
 }
 
 auto make_indices(std::size_t size)
@@ -360,8 +431,16 @@ void fill_two_vector(cntgs::ContiguousVector<T...>& target, const std::vector<st
 {
     for (auto&& v : source)
     {
-        target.emplace_back(cntgs::Span{v.data(), v.data() + v.size() / 2}, v.front(),
-                            cntgs::Span{v.data() + v.size() / 2, v.data() + v.size()});
+        const cntgs::Span a{v.data(), v.data() + v.size() / 2};
+        const cntgs::Span c{v.data() + v.size() / 2, v.data() + v.size()};
+        if constexpr (std::tuple_size_v<typename cntgs::ContiguousVector<T...>::value_type> == 3)
+        {
+            target.emplace_back(a, v.front(), c);
+        }
+        else
+        {
+            target.emplace_back(a.size(), a, v.front(), c.size(), c);
+        }
     }
 }
 
@@ -451,7 +530,7 @@ BENCHMARK_TEMPLATE(BM_full_iteration, 2, 45)
     ->ArgsProduct({INPUT_SIZES, {15, 30, 45}});
 
 BENCHMARK_TEMPLATE(BM_full_iteration, 3, 45)
-    ->Name("full iteration: ContiguousVector<VaryingSize<float>>")
+    ->Name("full iteration: ContiguousVector<size_t, VaryingSize<float>>")
     ->ArgsProduct({INPUT_SIZES, {15, 30, 45}});
 
 template <std::size_t I, std::size_t N>
@@ -486,7 +565,34 @@ BENCHMARK_TEMPLATE(BM_random_lookup, 2, 45)
     ->ArgsProduct({INPUT_SIZES, {15, 30, 45}});
 
 BENCHMARK_TEMPLATE(BM_random_lookup, 3, 45)
-    ->Name("random lookup: ContiguousVector<VaryingSize<float>>")
+    ->Name("random lookup: ContiguousVector<size_t, VaryingSize<float>>")
+    ->ArgsProduct({INPUT_SIZES, {15, 30, 45}});
+
+BENCHMARK_TEMPLATE(BM_random_lookup, 4, 45)
+    ->Name("random lookup: ContiguousVector<MmapAllocator, FixedSize<float>>")
+    ->ArgsProduct({INPUT_SIZES, {15, 30, 45}});
+
+template <std::size_t I, std::size_t N>
+void BM_batched_random_lookup(benchmark::State& state)
+{
+    auto [fixed_size, input] = SingleElementInputVectors<I, N>{state};
+    auto indices = make_indices(state.range(0));
+    for (auto _ : state)
+    {
+        batched_random_lookup(input, indices);
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_batched_random_lookup, 2, 45)
+    ->Name("batched random lookup: ContiguousVector<FixedSize<float>>")
+    ->ArgsProduct({INPUT_SIZES, {15, 30, 45}});
+
+BENCHMARK_TEMPLATE(BM_batched_random_lookup, 3, 45)
+    ->Name("batched random lookup: ContiguousVector<size_t, VaryingSize<float>>")
+    ->ArgsProduct({INPUT_SIZES, {15, 30, 45}});
+
+BENCHMARK_TEMPLATE(BM_batched_random_lookup, 4, 45)
+    ->Name("batched random lookup: ContiguousVector<MmapAllocator, FixedSize<float>>")
     ->ArgsProduct({INPUT_SIZES, {15, 30, 45}});
 
 template <std::size_t I>
@@ -516,7 +622,7 @@ static std::vector<int64_t> VARYING_ITERATION_VARIANCES{10, 100, 1000};
 template <std::size_t I>
 void BM_full_varying_iteration(benchmark::State& state)
 {
-    auto [input] = VaryingSizeInputVectors<0>{state};
+    auto [input] = VaryingSizeInputVectors<I>{state};
     for (auto _ : state)
     {
         iterate(input, {});
@@ -528,13 +634,13 @@ BENCHMARK_TEMPLATE(BM_full_varying_iteration, 0)
     ->ArgsProduct({VARYING_ITERATION_INPUT_SIZES, VARYING_ITERATION_VARIANCES});
 
 BENCHMARK_TEMPLATE(BM_full_varying_iteration, 1)
-    ->Name("full varying iteration: ContiguousVector<VaryingSize<float>>")
+    ->Name("full varying iteration: ContiguousVector<size_t, VaryingSize<float>>")
     ->ArgsProduct({VARYING_ITERATION_INPUT_SIZES, VARYING_ITERATION_VARIANCES});
 
 template <std::size_t I>
 void BM_random_varying_lookup(benchmark::State& state)
 {
-    auto [input] = VaryingSizeInputVectors<0>{state};
+    auto [input] = VaryingSizeInputVectors<I>{state};
     auto indices = make_indices(state.range(0));
     for (auto _ : state)
     {
@@ -547,7 +653,38 @@ BENCHMARK_TEMPLATE(BM_random_varying_lookup, 0)
     ->ArgsProduct({VARYING_ITERATION_INPUT_SIZES, VARYING_ITERATION_VARIANCES});
 
 BENCHMARK_TEMPLATE(BM_random_varying_lookup, 1)
-    ->Name("random varying lookup: ContiguousVector<VaryingSize<float>>")
+    ->Name("random varying lookup: ContiguousVector<size_t, VaryingSize<float>>")
+    ->ArgsProduct({VARYING_ITERATION_INPUT_SIZES, VARYING_ITERATION_VARIANCES});
+
+BENCHMARK_TEMPLATE(BM_random_varying_lookup, 2)
+    ->Name("random varying lookup: ContiguousVector<SampledIndex<16>, size_t, VaryingSize<float>>")
+    ->ArgsProduct({VARYING_ITERATION_INPUT_SIZES, VARYING_ITERATION_VARIANCES});
+
+BENCHMARK_TEMPLATE(BM_random_varying_lookup, 3)
+    ->Name("random varying lookup: ContiguousVector<SampledIndex<64>, size_t, VaryingSize<float>>")
+    ->ArgsProduct({VARYING_ITERATION_INPUT_SIZES, VARYING_ITERATION_VARIANCES});
+
+template <std::size_t I>
+void BM_batched_random_varying_lookup(benchmark::State& state)
+{
+    auto [input] = VaryingSizeInputVectors<I>{state};
+    auto indices = make_indices(state.range(0));
+    for (auto _ : state)
+    {
+        batched_random_lookup(input, indices);
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_batched_random_varying_lookup, 1)
+    ->Name("batched random varying lookup: ContiguousVector<size_t, VaryingSize<float>>")
+    ->ArgsProduct({VARYING_ITERATION_INPUT_SIZES, VARYING_ITERATION_VARIANCES});
+
+BENCHMARK_TEMPLATE(BM_batched_random_varying_lookup, 2)
+    ->Name("batched random varying lookup: ContiguousVector<SampledIndex<16>, size_t, VaryingSize<float>>")
+    ->ArgsProduct({VARYING_ITERATION_INPUT_SIZES, VARYING_ITERATION_VARIANCES});
+
+BENCHMARK_TEMPLATE(BM_batched_random_varying_lookup, 3)
+    ->Name("batched random varying lookup: ContiguousVector<SampledIndex<64>, size_t, VaryingSize<float>>")
     ->ArgsProduct({VARYING_ITERATION_INPUT_SIZES, VARYING_ITERATION_VARIANCES});
 
 //---- Multi element
@@ -602,7 +739,7 @@ BENCHMARK_TEMPLATE(BM_full_iteration_two, 2, 45)
     ->ArgsProduct({INPUT_SIZES, {20, 25, 30, 70, 80, 90}});
 
 BENCHMARK_TEMPLATE(BM_full_iteration_two, 3, 45)
-    ->Name("full iteration2: ContiguousVector<VaryingSize<float>,float,VaryingSize<float>>")
+    ->Name("full iteration2: ContiguousVector<size_t,VaryingSize<float>,float,size_t,VaryingSize<float>>")
     ->ArgsProduct({INPUT_SIZES, {20, 25, 30, 70, 80, 90}});
 
 BENCHMARK_TEMPLATE(BM_full_iteration_two, 4, 45)
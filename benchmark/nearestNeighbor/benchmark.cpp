@@ -3,6 +3,7 @@
 // This software is released under the MIT License.
 // https://opensource.org/licenses/MIT
 
+#include "nearestNeighbor/generate.hpp"
 #include "nearestNeighbor/graph.hpp"
 #include "nearestNeighbor/load.hpp"
 #include "nearestNeighbor/repository.hpp"
@@ -10,42 +11,276 @@
 
 #include <benchmark/benchmark.h>
 
+#include <thread>
+#include <vector>
+
 namespace cntgs::bench
 {
+inline const std::filesystem::path DATA_PATH{CNTGS_BENCHMARK_GRAPH_DATA_DIR};
+inline const auto GRAPH_PATH =
+    DATA_PATH / "k24nns_128D_L2_Path10_Rnd3+3_AddK20Eps0.2_ImproveK20Eps0.02_ImproveExtK12-1StepEps0.02.deg";
+
+enum class SearchVariant
+{
+    NEW_STATE,
+    SEARCH_CONTEXT,
+    SEARCH_CONTEXT_PREFETCH
+};
+
 template <class Container>
-void BM_nearest_neighbor(benchmark::State& state)
+void run_nearest_neighbor(benchmark::State& state, const std::filesystem::path& graph_path,
+                          const std::filesystem::path& repository_path, SearchVariant variant)
 {
-    std::filesystem::path data_path{CNTGS_BENCHMARK_GRAPH_DATA_DIR};
-    auto repository = bench::load_static_repository(data_path / "SIFT1M" / "sift_query.fvecs");
-    auto graph = bench::load_graph<Container>(
-        data_path / "k24nns_128D_L2_Path10_Rnd3+3_AddK20Eps0.2_ImproveK20Eps0.02_ImproveExtK12-1StepEps0.02.deg");
+    auto repository = bench::load_static_repository(repository_path);
+    auto graph = bench::load_graph<Container>(graph_path);
     const std::vector<uint32_t> entry_node_indices{graph.get_internal_index(0)};
     const auto search_radius_epsilon = 0.01f;
     const size_t search_results = 100;
+    bench::SearchContext<> context{graph.size(), search_results};
     size_t queries_processed{};
     for (auto _ : state)
     {
         for (size_t i = 0; i < repository.size; i++)
         {
             auto query = reinterpret_cast<const std::byte*>(repository.get_feature(i));
-            auto result_queue =
-                bench::yahoo_search(graph, entry_node_indices, query, search_radius_epsilon, search_results);
-            benchmark::DoNotOptimize(result_queue);
+            if (variant == SearchVariant::SEARCH_CONTEXT)
+            {
+                const auto& result_queue = bench::yahoo_search(graph, entry_node_indices, query, search_radius_epsilon,
+                                                               search_results, context);
+                benchmark::DoNotOptimize(result_queue);
+            }
+            else if (variant == SearchVariant::SEARCH_CONTEXT_PREFETCH)
+            {
+                const auto& result_queue = bench::yahoo_search<true>(graph, entry_node_indices, query,
+                                                                     search_radius_epsilon, search_results, context);
+                benchmark::DoNotOptimize(result_queue);
+            }
+            else
+            {
+                auto result_queue =
+                    bench::yahoo_search(graph, entry_node_indices, query, search_radius_epsilon, search_results);
+                benchmark::DoNotOptimize(result_queue);
+            }
             ++queries_processed;
         }
     }
     state.SetItemsProcessed(queries_processed);
 }
 
+template <class Container>
+void BM_nearest_neighbor(benchmark::State& state)
+{
+    bench::run_nearest_neighbor<Container>(state, GRAPH_PATH, DATA_PATH / "SIFT1M" / "sift_query.fvecs",
+                                           static_cast<SearchVariant>(state.range(0)));
+}
+
 static constexpr auto ITERATION = 20;
 
 BENCHMARK_TEMPLATE(BM_nearest_neighbor, bench::FixedSizeContainer)
     ->Name("nearest neighbor cntgs")
+    ->ArgName("search")
+    ->DenseRange(0, 2)
+    ->Iterations(ITERATION);
+
+BENCHMARK_TEMPLATE(BM_nearest_neighbor, bench::MappedFixedSizeContainer)
+    ->Name("nearest neighbor cntgs mapped")
+    ->ArgName("search")
+    ->DenseRange(0, 2)
     ->Iterations(ITERATION);
 
 BENCHMARK_TEMPLATE(BM_nearest_neighbor, bench::VectorContainer)
     ->Name("nearest neighbor pmr::vector")
+    ->ArgName("search")
+    ->DenseRange(0, 2)
+    ->Iterations(ITERATION);
+
+BENCHMARK_TEMPLATE(BM_nearest_neighbor, bench::ArrayContainer)
+    ->Name("nearest neighbor array")
+    ->ArgName("search")
+    ->DenseRange(0, 2)
     ->Iterations(ITERATION);
 
-BENCHMARK_TEMPLATE(BM_nearest_neighbor, bench::ArrayContainer)->Name("nearest neighbor array")->Iterations(ITERATION);
+// Runs on a generated graph with 128 dimensions and 24 edges per node, the layout of ArrayContainer, so that no data
+// set needs to be downloaded. The arguments are the number of nodes and the SearchVariant.
+template <class Container>
+void BM_nearest_neighbor_synthetic(benchmark::State& state)
+{
+    bench::SyntheticGraphParameter parameter;
+    parameter.node_count = static_cast<uint32_t>(state.range(0));
+    const auto files = bench::generate_synthetic_graph_files(parameter);
+    bench::run_nearest_neighbor<Container>(state, files.graph, files.queries,
+                                           static_cast<SearchVariant>(state.range(1)));
+}
+
+static constexpr auto SYNTHETIC_ITERATION = 5;
+
+BENCHMARK_TEMPLATE(BM_nearest_neighbor_synthetic, bench::FixedSizeContainer)
+    ->Name("nearest neighbor synthetic cntgs")
+    ->ArgNames({"nodes", "search"})
+    ->ArgsProduct({{100000, 2000000}, {0, 1, 2}})
+    ->Iterations(SYNTHETIC_ITERATION);
+
+BENCHMARK_TEMPLATE(BM_nearest_neighbor_synthetic, bench::VectorContainer)
+    ->Name("nearest neighbor synthetic pmr::vector")
+    ->ArgNames({"nodes", "search"})
+    ->ArgsProduct({{100000, 2000000}, {0, 1, 2}})
+    ->Iterations(SYNTHETIC_ITERATION);
+
+BENCHMARK_TEMPLATE(BM_nearest_neighbor_synthetic, bench::ArrayContainer)
+    ->Name("nearest neighbor synthetic array")
+    ->ArgNames({"nodes", "search"})
+    ->ArgsProduct({{100000, 2000000}, {0, 1, 2}})
+    ->Iterations(SYNTHETIC_ITERATION);
+
+// Partitions the queries into one contiguous range per thread, every thread searches with its own SearchContext
+template <class Container>
+void run_nearest_neighbor_threads(benchmark::State& state, const std::filesystem::path& graph_path,
+                                  const std::filesystem::path& repository_path, size_t thread_count)
+{
+    auto repository = bench::load_static_repository(repository_path);
+    auto graph = bench::load_graph<Container>(graph_path);
+    const std::vector<uint32_t> entry_node_indices{graph.get_internal_index(0)};
+    const auto search_radius_epsilon = 0.01f;
+    const size_t search_results = 100;
+    std::vector<bench::SearchContext<>> contexts;
+    contexts.reserve(thread_count);
+    for (size_t t = 0; t < thread_count; t++)
+    {
+        contexts.emplace_back(graph.size(), search_results);
+    }
+    std::vector<std::thread> threads;
+    threads.reserve(thread_count);
+    size_t queries_processed{};
+    for (auto _ : state)
+    {
+        for (size_t t = 0; t < thread_count; t++)
+        {
+            threads.emplace_back(
+                [&, t]
+                {
+                    const auto first = repository.size * t / thread_count;
+                    const auto last = repository.size * (t + 1) / thread_count;
+                    for (size_t i = first; i < last; i++)
+                    {
+                        auto query = reinterpret_cast<const std::byte*>(repository.get_feature(i));
+                        const auto& result_queue = bench::yahoo_search(
+                            graph, entry_node_indices, query, search_radius_epsilon, search_results, contexts[t]);
+                        benchmark::DoNotOptimize(result_queue);
+                    }
+                });
+        }
+        for (auto&& thread : threads)
+        {
+            thread.join();
+        }
+        threads.clear();
+        queries_processed += repository.size;
+    }
+    state.SetItemsProcessed(queries_processed);
+    state.counters["queries_per_thread"] =
+        benchmark::Counter(static_cast<double>(queries_processed) / thread_count, benchmark::Counter::kIsRate);
+}
+
+// The argument is the number of threads
+template <class Container>
+void BM_nearest_neighbor_threads(benchmark::State& state)
+{
+    bench::run_nearest_neighbor_threads<Container>(state, GRAPH_PATH, DATA_PATH / "SIFT1M" / "sift_query.fvecs",
+                                                   static_cast<size_t>(state.range(0)));
+}
+
+BENCHMARK_TEMPLATE(BM_nearest_neighbor_threads, bench::FixedSizeContainer)
+    ->Name("nearest neighbor threads cntgs")
+    ->ArgName("threads")
+    ->RangeMultiplier(2)
+    ->Range(1, 32)
+    ->Iterations(ITERATION)
+    ->UseRealTime();
+
+BENCHMARK_TEMPLATE(BM_nearest_neighbor_threads, bench::VectorContainer)
+    ->Name("nearest neighbor threads pmr::vector")
+    ->ArgName("threads")
+    ->RangeMultiplier(2)
+    ->Range(1, 32)
+    ->Iterations(ITERATION)
+    ->UseRealTime();
+
+BENCHMARK_TEMPLATE(BM_nearest_neighbor_threads, bench::ArrayContainer)
+    ->Name("nearest neighbor threads array")
+    ->ArgName("threads")
+    ->RangeMultiplier(2)
+    ->Range(1, 32)
+    ->Iterations(ITERATION)
+    ->UseRealTime();
+
+// The arguments are the number of nodes of the generated graph and the number of threads
+template <class Container>
+void BM_nearest_neighbor_synthetic_threads(benchmark::State& state)
+{
+    bench::SyntheticGraphParameter parameter;
+    parameter.node_count = static_cast<uint32_t>(state.range(0));
+    const auto files = bench::generate_synthetic_graph_files(parameter);
+    bench::run_nearest_neighbor_threads<Container>(state, files.graph, files.queries,
+                                                   static_cast<size_t>(state.range(1)));
+}
+
+BENCHMARK_TEMPLATE(BM_nearest_neighbor_synthetic_threads, bench::FixedSizeContainer)
+    ->Name("nearest neighbor synthetic threads cntgs")
+    ->ArgNames({"nodes", "threads"})
+    ->ArgsProduct({{2000000}, benchmark::CreateRange(1, 32, 2)})
+    ->Iterations(SYNTHETIC_ITERATION)
+    ->UseRealTime();
+
+BENCHMARK_TEMPLATE(BM_nearest_neighbor_synthetic_threads, bench::VectorContainer)
+    ->Name("nearest neighbor synthetic threads pmr::vector")
+    ->ArgNames({"nodes", "threads"})
+    ->ArgsProduct({{2000000}, benchmark::CreateRange(1, 32, 2)})
+    ->Iterations(SYNTHETIC_ITERATION)
+    ->UseRealTime();
+
+BENCHMARK_TEMPLATE(BM_nearest_neighbor_synthetic_threads, bench::ArrayContainer)
+    ->Name("nearest neighbor synthetic threads array")
+    ->ArgNames({"nodes", "threads"})
+    ->ArgsProduct({{2000000}, benchmark::CreateRange(1, 32, 2)})
+    ->Iterations(SYNTHETIC_ITERATION)
+    ->UseRealTime();
+
+enum class GraphLoader
+{
+    STREAM,
+    BLOCKS,
+    BLOCKS_READ_AHEAD
+};
+
+template <class Container>
+void BM_load_graph(benchmark::State& state)
+{
+    const auto loader = static_cast<GraphLoader>(state.range(0));
+    size_t nodes_loaded{};
+    for (auto _ : state)
+    {
+        auto graph = loader == GraphLoader::STREAM
+                         ? bench::load_graph_from_stream<Container>(GRAPH_PATH)
+                         : bench::load_graph_in_blocks<Container>(GRAPH_PATH, loader == GraphLoader::BLOCKS_READ_AHEAD);
+        nodes_loaded += graph.size();
+        benchmark::DoNotOptimize(graph);
+    }
+    state.SetItemsProcessed(nodes_loaded);
+}
+
+static constexpr auto LOAD_ITERATION = 5;
+
+BENCHMARK_TEMPLATE(BM_load_graph, bench::FixedSizeContainer)
+    ->Name("load graph cntgs")
+    ->ArgName("loader")
+    ->DenseRange(0, 2)
+    ->Iterations(LOAD_ITERATION)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE(BM_load_graph, bench::VectorContainer)
+    ->Name("load graph pmr::vector")
+    ->ArgName("loader")
+    ->DenseRange(0, 2)
+    ->Iterations(LOAD_ITERATION)
+    ->Unit(benchmark::kMillisecond);
 }  // namespace cntgs::bench
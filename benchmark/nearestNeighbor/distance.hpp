@@ -241,6 +241,14 @@ inline void prefetch(const char* ptr)
     _mm_prefetch(ptr, _MM_HINT_T0);
 #endif
 }
+
+inline void prefetch(const char* ptr, size_t size)
+{
+    for (size_t offset = 0; offset < size; offset += 64)
+    {
+        bench::prefetch(ptr + offset);
+    }
+}
 }  // namespace cntgs::bench
 
 #endif  // CNTGS_NEARESTNEIGHBOR_DISTANCE_HPP
@@ -0,0 +1,186 @@
+// Copyright (c) 2021 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef CNTGS_NEARESTNEIGHBOR_GENERATE_HPP
+#define CNTGS_NEARESTNEIGHBOR_GENERATE_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace cntgs::bench
+{
+struct SyntheticGraphParameter
+{
+    uint32_t node_count{100000};
+    uint16_t dim{128};
+    uint8_t edges_per_node{24};
+    uint32_t cluster_count{256};
+    uint32_t query_count{1000};
+    uint64_t seed{42};
+};
+
+struct SyntheticGraphFiles
+{
+    std::filesystem::path graph;
+    std::filesystem::path queries;
+};
+
+// std::mt19937_64 is specified exactly, unlike the standard distributions, so the files are identical on all platforms
+class SyntheticFeatureGenerator
+{
+  public:
+    explicit SyntheticFeatureGenerator(const SyntheticGraphParameter& parameter)
+        : dim(parameter.dim), centers(size_t{parameter.cluster_count} * parameter.dim)
+    {
+        std::mt19937_64 random{parameter.seed};
+        for (auto& center : centers)
+        {
+            center = 100.f * uniform(random);
+        }
+    }
+
+    // Features of a node only depend on the seed and the node index, so that they never need to be held in memory
+    void node_features(uint64_t seed, uint32_t cluster, uint64_t index, std::vector<float>& features) const
+    {
+        std::mt19937_64 random{seed ^ (index * 0x9E3779B97F4A7C15ULL)};
+        features.resize(dim);
+        const auto* center = &centers[size_t{cluster} * dim];
+        for (size_t i = 0; i < dim; ++i)
+        {
+            // approximately normal distributed noise with a standard deviation of five
+            const auto noise = uniform(random) + uniform(random) + uniform(random) + uniform(random) - 2.f;
+            features[i] = center[i] + 8.66f * noise;
+        }
+    }
+
+    static float uniform(std::mt19937_64& random) { return static_cast<float>(random() >> 40) * 0x1.0p-24f; }
+
+  private:
+    size_t dim;
+    std::vector<float> centers;
+};
+
+// Writes a graph in the .deg format where every node has exactly `edges_per_node` distinct neighbors. All but one
+// neighbor are chosen from the cluster of the node, the last one from the whole graph to keep the clusters connected.
+inline void write_synthetic_graph(const std::filesystem::path& path, const SyntheticGraphParameter& parameter)
+{
+    const uint32_t node_count = parameter.node_count;
+    const uint32_t cluster_count = (std::min)(parameter.cluster_count, node_count);
+    const size_t edges_per_node = parameter.edges_per_node;
+    if (node_count <= edges_per_node)
+    {
+        std::cerr << "A graph with " << edges_per_node << " edges per node needs more than " << node_count
+                  << " nodes\n";
+        abort();
+    }
+    SyntheticFeatureGenerator generator{parameter};
+    std::mt19937_64 random{parameter.seed + 1};
+    std::ofstream ofstream{path, std::ios::binary | std::ios::trunc};
+    const uint8_t data_type = 1;
+    ofstream.write(reinterpret_cast<const char*>(&data_type), sizeof(data_type));
+    ofstream.write(reinterpret_cast<const char*>(&parameter.dim), sizeof(parameter.dim));
+    ofstream.write(reinterpret_cast<const char*>(&node_count), sizeof(node_count));
+    ofstream.write(reinterpret_cast<const char*>(&parameter.edges_per_node), sizeof(parameter.edges_per_node));
+    std::vector<float> features;
+    std::vector<uint32_t> neighbor_indices;
+    // the loaders skip the weights
+    const std::vector<float> weights(edges_per_node);
+    for (uint32_t i = 0; i < node_count; ++i)
+    {
+        const auto cluster = i % cluster_count;
+        const auto cluster_size = (node_count - cluster + cluster_count - 1) / cluster_count;
+        const auto add_neighbor = [&](uint32_t neighbor)
+        {
+            if (neighbor != i && std::find(neighbor_indices.begin(), neighbor_indices.end(), neighbor) ==
+                                     neighbor_indices.end())
+            {
+                neighbor_indices.push_back(neighbor);
+            }
+        };
+        neighbor_indices.clear();
+        if (cluster_size > edges_per_node)
+        {
+            while (neighbor_indices.size() < edges_per_node - 1)
+            {
+                add_neighbor(cluster + static_cast<uint32_t>(random() % cluster_size) * cluster_count);
+            }
+        }
+        while (neighbor_indices.size() < edges_per_node)
+        {
+            add_neighbor(static_cast<uint32_t>(random() % node_count));
+        }
+        generator.node_features(parameter.seed, cluster, i, features);
+        ofstream.write(reinterpret_cast<const char*>(features.data()), features.size() * sizeof(float));
+        ofstream.write(reinterpret_cast<const char*>(neighbor_indices.data()),
+                       neighbor_indices.size() * sizeof(uint32_t));
+        ofstream.write(reinterpret_cast<const char*>(weights.data()), weights.size() * sizeof(float));
+        ofstream.write(reinterpret_cast<const char*>(&i), sizeof(i));
+    }
+    if (!ofstream.flush())
+    {
+        std::cerr << "Could not write " << path << "\n";
+        abort();
+    }
+}
+
+// Writes queries in the .fvecs format that are drawn from the same clusters as the nodes of the graph
+inline void write_synthetic_queries(const std::filesystem::path& path, const SyntheticGraphParameter& parameter)
+{
+    const uint32_t cluster_count = (std::min)(parameter.cluster_count, parameter.node_count);
+    SyntheticFeatureGenerator generator{parameter};
+    std::mt19937_64 random{parameter.seed + 2};
+    std::ofstream ofstream{path, std::ios::binary | std::ios::trunc};
+    const int32_t dim = parameter.dim;
+    std::vector<float> features;
+    for (uint32_t i = 0; i < parameter.query_count; ++i)
+    {
+        const auto cluster = static_cast<uint32_t>(random() % cluster_count);
+        generator.node_features(parameter.seed + 3, cluster, i, features);
+        ofstream.write(reinterpret_cast<const char*>(&dim), sizeof(dim));
+        ofstream.write(reinterpret_cast<const char*>(features.data()), features.size() * sizeof(float));
+    }
+    if (!ofstream.flush())
+    {
+        std::cerr << "Could not write " << path << "\n";
+        abort();
+    }
+}
+
+// Generates the graph and the queries into the temporary directory unless they have been generated before
+inline SyntheticGraphFiles generate_synthetic_graph_files(const SyntheticGraphParameter& parameter)
+{
+    const auto name = "cntgs-synthetic-n" + std::to_string(parameter.node_count) + "-d" +
+                      std::to_string(parameter.dim) + "-k" + std::to_string(parameter.edges_per_node) + "-c" +
+                      std::to_string(parameter.cluster_count) + "-q" + std::to_string(parameter.query_count) + "-s" +
+                      std::to_string(parameter.seed);
+    const auto directory = std::filesystem::temp_directory_path();
+    SyntheticGraphFiles files{directory / (name + ".deg"), directory / (name + ".fvecs")};
+    if (!std::filesystem::exists(files.graph))
+    {
+        // generate under a different name first so that an interrupted run does not leave a truncated graph behind
+        auto path = files.graph;
+        path += ".tmp";
+        bench::write_synthetic_graph(path, parameter);
+        std::filesystem::rename(path, files.graph);
+    }
+    if (!std::filesystem::exists(files.queries))
+    {
+        auto path = files.queries;
+        path += ".tmp";
+        bench::write_synthetic_queries(path, parameter);
+        std::filesystem::rename(path, files.queries);
+    }
+    return files;
+}
+}  // namespace cntgs::bench
+
+#endif  // CNTGS_NEARESTNEIGHBOR_GENERATE_HPP
@@ -9,6 +9,7 @@
 #include "nearestNeighbor/distance.hpp"
 
 #include <cntgs/contiguous.hpp>
+#include <cntgs/mappedVector.hpp>
 
 #include <array>
 #include <cstdint>
@@ -55,6 +56,24 @@ struct Graph<FixedSizeContainer> : GraphBase<FixedSizeContainer>
     auto feature_by_index(size_t i) const { return std::next(this->container.begin(), i).data(); }
 
     auto neighbors_by_index(size_t i) const { return cntgs::get<1>(this->container[i]); }
+
+    void prefetch_by_index(size_t i) const { this->container.prefetch(i); }
+};
+
+using MappedFixedSizeContainer = cntgs::MappedContiguousVector<FixedSizeContainer>;
+
+template <>
+struct Graph<MappedFixedSizeContainer> : GraphBase<MappedFixedSizeContainer>
+{
+    using GraphBase<MappedFixedSizeContainer>::GraphBase;
+
+    auto get_external_label(size_t i) const { return cntgs::get<2>(this->container[i]); }
+
+    auto feature_by_index(size_t i) const { return std::next(this->container.begin(), i).data(); }
+
+    auto neighbors_by_index(size_t i) const { return cntgs::get<1>(this->container[i]); }
+
+    void prefetch_by_index(size_t i) const { this->container.prefetch(i); }
 };
 
 struct VectorContainer
@@ -123,6 +142,11 @@ struct Graph<VectorContainer> : GraphBase<VectorContainer>
     auto feature_by_index(size_t i) const { return this->container.data[i].features.data(); }
 
     auto& neighbors_by_index(size_t i) const { return this->container.data[i].neighbor_indices; }
+
+    void prefetch_by_index(size_t i) const
+    {
+        bench::prefetch(this->feature_by_index(i), this->feature_space.get_data_size());
+    }
 };
 
 struct ArrayContainer
@@ -165,6 +189,11 @@ struct Graph<ArrayContainer> : GraphBase<ArrayContainer>
     auto feature_by_index(size_t i) const { return this->container.data[i].features.data(); }
 
     auto& neighbors_by_index(size_t i) const { return this->container.data[i].neighbor_indices; }
+
+    void prefetch_by_index(size_t i) const
+    {
+        bench::prefetch(this->feature_by_index(i), this->feature_space.get_data_size());
+    }
 };
 }  // namespace cntgs::bench
 
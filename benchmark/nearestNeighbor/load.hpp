@@ -9,9 +9,16 @@
 #include "nearestNeighbor/distance.hpp"
 #include "nearestNeighbor/graph.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
+#include <future>
 #include <iostream>
+#include <memory>
+#include <type_traits>
 
 namespace cntgs::bench
 {
@@ -52,25 +59,137 @@ auto load(uint32_t max_node_count, uint8_t edges_per_node, bench::L2Space featur
     return graph;
 }
 
-template <class Container>
-auto load_graph(const std::filesystem::path& path_graph)
+struct GraphFileHeader
 {
-    auto ifstream = open_file_stream(path_graph);
+    uint16_t dim;
+    uint32_t size;
+    uint8_t edges_per_node;
+};
 
-    // create feature space
+inline auto read_graph_file_header(std::ifstream& ifstream)
+{
+    GraphFileHeader header;
     uint8_t data_type;
     ifstream.read(reinterpret_cast<char*>(&data_type), sizeof(data_type));
-    uint16_t dim;
-    ifstream.read(reinterpret_cast<char*>(&dim), sizeof(dim));
-    auto feature_space = bench::L2Space(dim);
+    ifstream.read(reinterpret_cast<char*>(&header.dim), sizeof(header.dim));
+    ifstream.read(reinterpret_cast<char*>(&header.size), sizeof(header.size));
+    ifstream.read(reinterpret_cast<char*>(&header.edges_per_node), sizeof(header.edges_per_node));
+    return header;
+}
 
-    // create the graph
-    uint32_t size;
-    ifstream.read(reinterpret_cast<char*>(&size), sizeof(size));
-    uint8_t edges_per_node;
-    ifstream.read(reinterpret_cast<char*>(&edges_per_node), sizeof(edges_per_node));
+template <class Container>
+auto load_graph_from_stream(const std::filesystem::path& path_graph)
+{
+    auto ifstream = open_file_stream(path_graph);
+    const auto header = bench::read_graph_file_header(ifstream);
+    return bench::load<Container>(header.size, header.edges_per_node, bench::L2Space(header.dim), ifstream);
+}
+
+// Reads the nodes in blocks of several megabytes with a single call each and passes features and neighbor indices
+// from the block straight to emplace_back. With read-ahead the next block is read on another thread while the current
+// one is stored into the container, emplace_back itself is sequential.
+template <class Container>
+auto load_graph_in_blocks(const std::filesystem::path& path_graph, bool read_ahead = true)
+{
+    static constexpr size_t BLOCK_SIZE = size_t{8} << 20;
+
+    auto ifstream = open_file_stream(path_graph);
+    const auto header = bench::read_graph_file_header(ifstream);
+    const auto feature_space = bench::L2Space(header.dim);
+    const auto data_size = feature_space.get_data_size();
+    const size_t edges_per_node = header.edges_per_node;
+    // features, neighbor indices, weights and the external label
+    const auto node_size = data_size + 2 * edges_per_node * sizeof(uint32_t) + sizeof(uint32_t);
+    const auto block_node_count = (std::max)(size_t{1}, BLOCK_SIZE / node_size);
+
+    auto graph = bench::Graph<Container>::construct(header.size, feature_space, edges_per_node);
+    graph.label_to_index.reserve(header.size);
+
+    std::array<std::unique_ptr<uint32_t[]>, 2> blocks;
+    for (auto& block : blocks)
+    {
+        block = std::make_unique<uint32_t[]>(block_node_count * node_size / sizeof(uint32_t) + 1);
+    }
+    const auto read_block = [&](uint32_t* block, size_t node_count)
+    {
+        ifstream.read(reinterpret_cast<char*>(block), static_cast<std::streamsize>(node_count * node_size));
+    };
+    const auto node_count_of_block = [&](size_t first_node)
+    {
+        return (std::min)(block_node_count, header.size - first_node);
+    };
 
-    return bench::load<Container>(size, edges_per_node, feature_space, ifstream);
+    size_t current = 0;
+    read_block(blocks[current].get(), node_count_of_block(0));
+    for (size_t first_node = 0; first_node < header.size; first_node += block_node_count, current ^= 1)
+    {
+        const auto next_first_node = first_node + block_node_count;
+        std::future<void> next_block;
+        if (next_first_node < header.size)
+        {
+            next_block = std::async(read_ahead ? std::launch::async : std::launch::deferred, read_block,
+                                    blocks[current ^ 1].get(), node_count_of_block(next_first_node));
+        }
+        const auto* node = reinterpret_cast<const char*>(blocks[current].get());
+        for (size_t i = first_node; i < first_node + node_count_of_block(first_node); ++i, node += node_size)
+        {
+            const auto* neighbor_indices = reinterpret_cast<const uint32_t*>(node + data_size);
+            uint32_t external_label;
+            std::memcpy(&external_label, node + node_size - sizeof(uint32_t), sizeof(uint32_t));
+            graph.container.emplace_back(cntgs::Span<const char>{node, data_size},
+                                         cntgs::Span<const uint32_t>{neighbor_indices, edges_per_node},
+                                         external_label);
+            graph.label_to_index.emplace(external_label, static_cast<uint32_t>(i));
+        }
+        if (next_block.valid())
+        {
+            next_block.get();
+        }
+    }
+    return graph;
+}
+
+// Converts the graph into the file format of cntgs::write_to_file once, subsequent loads only map the converted file
+inline auto load_mapped_graph(const std::filesystem::path& path_graph)
+{
+    auto path_mapped = path_graph;
+    path_mapped += ".cntgs";
+    if (!std::filesystem::exists(path_mapped))
+    {
+        const auto graph = bench::load_graph_in_blocks<bench::FixedSizeContainer>(path_graph);
+        if (!cntgs::write_to_file(graph.container, path_mapped.c_str()))
+        {
+            std::cerr << "Could not write " << path_mapped << "\n";
+            abort();
+        }
+    }
+    bench::MappedFixedSizeContainer container{path_mapped.c_str()};
+    if (!container.is_open())
+    {
+        std::cerr << "Could not map " << path_mapped << "\n";
+        abort();
+    }
+    const auto dim = container.get_fixed_size<0>() / sizeof(float);
+    bench::Graph<bench::MappedFixedSizeContainer> graph{bench::L2Space(dim), std::move(container)};
+    graph.label_to_index.reserve(graph.container.size());
+    for (uint32_t i = 0; i < graph.container.size(); i++)
+    {
+        graph.label_to_index.emplace(graph.get_external_label(i), i);
+    }
+    return graph;
+}
+
+template <class Container>
+auto load_graph(const std::filesystem::path& path_graph)
+{
+    if constexpr (std::is_same_v<Container, bench::MappedFixedSizeContainer>)
+    {
+        return bench::load_mapped_graph(path_graph);
+    }
+    else
+    {
+        return bench::load_graph_in_blocks<Container>(path_graph);
+    }
 }
 }  // namespace cntgs::bench
 
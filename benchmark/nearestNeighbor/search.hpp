@@ -8,9 +8,12 @@
 
 #include "nearestNeighbor/graph.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cstdint>
 #include <limits>
 #include <queue>
+#include <vector>
 
 namespace cntgs::bench
 {
@@ -56,28 +59,101 @@ struct ObjectDistance
     }
 };
 
-template <class Container>
-auto yahoo_search(const bench::Graph<Container>& graph, const std::vector<uint32_t>& entry_node_indizies,
-                  const std::byte* query, const float eps, const size_t k)
+using ResultSet = std::priority_queue<ObjectDistance, std::vector<ObjectDistance>, std::less<ObjectDistance>>;
+using UncheckedSet = std::priority_queue<ObjectDistance, std::vector<ObjectDistance>, std::greater<ObjectDistance>>;
+
+// Priority queue that can be cleared without giving up the memory of its container
+template <class Queue>
+struct ReusableQueue : Queue
 {
-    using ResultSet = std::priority_queue<ObjectDistance, std::vector<ObjectDistance>, std::less<ObjectDistance>>;
-    using UncheckedSet = std::priority_queue<ObjectDistance, std::vector<ObjectDistance>, std::greater<ObjectDistance>>;
+    void clear() noexcept { this->c.clear(); }
 
-    const auto dist_func = graph.feature_space.get_dist_func();
-    const auto dist_func_param = graph.feature_space.get_dist_func_param();
+    void reserve(size_t size) { this->c.reserve(size); }
+};
 
-    // set of checked node ids
-    auto checked_ids = std::vector<bool>(graph.size());
+class CheckedBits
+{
+  public:
+    explicit CheckedBits(size_t size) : checked(size) {}
 
-    // items to traverse next
-    auto next_nodes = UncheckedSet();
+    bool insert(uint32_t index)
+    {
+        if (checked[index])
+        {
+            return false;
+        }
+        checked[index] = true;
+        return true;
+    }
 
-    auto results = ResultSet();
+  private:
+    std::vector<bool> checked;
+};
+
+// Marks nodes as checked by storing the current epoch. A new search only increments the epoch, the entries are reset
+// when it wraps around.
+template <class Epoch>
+class CheckedEpochs
+{
+  public:
+    void next_epoch(size_t size)
+    {
+        if (epochs.size() < size)
+        {
+            epochs.resize(size);
+        }
+        if (++epoch == Epoch{})
+        {
+            std::fill(epochs.begin(), epochs.end(), Epoch{});
+            epoch = 1;
+        }
+    }
+
+    bool insert(uint32_t index)
+    {
+        if (epochs[index] == epoch)
+        {
+            return false;
+        }
+        epochs[index] = epoch;
+        return true;
+    }
+
+  private:
+    std::vector<Epoch> epochs;
+    Epoch epoch{};
+};
+
+// State of yahoo_search that is reused across queries to avoid allocating and clearing it for every query
+template <class Epoch = uint16_t>
+struct SearchContext
+{
+    CheckedEpochs<Epoch> checked_ids;
+    ReusableQueue<UncheckedSet> next_nodes;
+    ReusableQueue<ResultSet> results;
+
+    SearchContext(size_t node_count, size_t k)
+    {
+        checked_ids.next_epoch(node_count);
+        next_nodes.reserve(4 * k);
+        results.reserve(k + 1);
+    }
+};
+
+// With `Prefetch` the features of the next unchecked neighbor are prefetched while the distance to the current one is
+// computed
+template <bool Prefetch = false, class Container, class CheckedIds>
+void yahoo_search(const bench::Graph<Container>& graph, const std::vector<uint32_t>& entry_node_indizies,
+                  const std::byte* query, const float eps, const size_t k, CheckedIds& checked_ids,
+                  UncheckedSet& next_nodes, ResultSet& results)
+{
+    const auto dist_func = graph.feature_space.get_dist_func();
+    const auto dist_func_param = graph.feature_space.get_dist_func_param();
 
     // copy the initial entry nodes and their distances to the query into the three containers
     for (auto&& index : entry_node_indizies)
     {
-        checked_ids[index] = true;
+        checked_ids.insert(index);
 
         const auto feature = reinterpret_cast<const float*>(graph.feature_by_index(index));
         const auto distance = dist_func(query, feature, dist_func_param);
@@ -106,20 +182,27 @@ auto yahoo_search(const bench::Graph<Container>& graph, const std::vector<uint32
         const auto neighbor_indices = graph.neighbors_by_index(next_node.internal_index);
         for (auto&& neighbor_index : neighbor_indices)
         {
-            if (checked_ids[neighbor_index] == false)
+            if (checked_ids.insert(neighbor_index))
             {
-                checked_ids[neighbor_index] = true;
                 good_neighbors[good_neighbor_count++] = neighbor_index;
             }
         }
 
         if (good_neighbor_count == 0) continue;
 
-        // bench::prefetch(reinterpret_cast<const char*>(graph.feature_by_index(good_neighbors[0])));
+        if constexpr (Prefetch)
+        {
+            graph.prefetch_by_index(good_neighbors[0]);
+        }
         for (size_t i = 0; i < good_neighbor_count; i++)
         {
-            // bench::prefetch(reinterpret_cast<const char*>(
-            //     graph.feature_by_index(good_neighbors[std::min(i + 1, good_neighbor_count - 1)])));
+            if constexpr (Prefetch)
+            {
+                if (i + 1 < good_neighbor_count)
+                {
+                    graph.prefetch_by_index(good_neighbors[i + 1]);
+                }
+            }
 
             const auto neighbor_index = good_neighbors[i];
             const auto neighbor_feature_vector = graph.feature_by_index(neighbor_index);
@@ -145,9 +228,36 @@ auto yahoo_search(const bench::Graph<Container>& graph, const std::vector<uint32
             }
         }
     }
+}
+
+template <bool Prefetch = false, class Container>
+auto yahoo_search(const bench::Graph<Container>& graph, const std::vector<uint32_t>& entry_node_indizies,
+                  const std::byte* query, const float eps, const size_t k)
+{
+    // set of checked node ids
+    auto checked_ids = bench::CheckedBits(graph.size());
 
+    // items to traverse next
+    auto next_nodes = UncheckedSet();
+
+    auto results = ResultSet();
+
+    bench::yahoo_search<Prefetch>(graph, entry_node_indizies, query, eps, k, checked_ids, next_nodes, results);
     return results;
 }
+
+template <bool Prefetch = false, class Container, class Epoch>
+const ResultSet& yahoo_search(const bench::Graph<Container>& graph, const std::vector<uint32_t>& entry_node_indizies,
+                              const std::byte* query, const float eps, const size_t k,
+                              bench::SearchContext<Epoch>& context)
+{
+    context.checked_ids.next_epoch(graph.size());
+    context.next_nodes.clear();
+    context.results.clear();
+    bench::yahoo_search<Prefetch>(graph, entry_node_indizies, query, eps, k, context.checked_ids, context.next_nodes,
+                                  context.results);
+    return context.results;
+}
 }  // namespace cntgs::bench
 
 #endif  // CNTGS_NEARESTNEIGHBOR_SEARCH_HPP
@@ -10,7 +10,11 @@
 #include "cntgs/iterator.hpp"
 #include "cntgs/parameter.hpp"
 #include "cntgs/reference.hpp"
+#include "cntgs/sampledIterator.hpp"
+#include "cntgs/scanIterator.hpp"
 #include "cntgs/span.hpp"
+#include "cntgs/typeTraits.hpp"
 #include "cntgs/vector.hpp"
+#include "cntgs/vectorView.hpp"
 
 #endif  // CNTGS_CNTGS_CONTIGUOUS_HPP
@@ -6,6 +6,7 @@
 #ifndef CNTGS_DETAIL_ALLOCATOR_HPP
 #define CNTGS_DETAIL_ALLOCATOR_HPP
 
+#include "cntgs/detail/typeTraits.hpp"
 #include "cntgs/detail/utility.hpp"
 
 #include <cstddef>
@@ -139,6 +140,22 @@ class AllocatorAwarePointer
 
     constexpr auto release() noexcept { return std::exchange(impl_.ptr_, nullptr); }
 
+    /// Resizes the allocation without copying if the allocator provides a `reallocate(pointer, old_n, new_n)` member
+    /// that returns a null pointer on failure
+    constexpr bool reallocate([[maybe_unused]] std::size_t new_size) noexcept
+    {
+        if constexpr (detail::HAS_REALLOCATE<Allocator>)
+        {
+            if (const auto new_ptr = get_allocator().reallocate(get(), size(), new_size))
+            {
+                get() = new_ptr;
+                size() = new_size;
+                return true;
+            }
+        }
+        return false;
+    }
+
     constexpr void reset(AllocatorAwarePointer&& other) noexcept
     {
         deallocate();
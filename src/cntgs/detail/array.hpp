@@ -38,6 +38,18 @@ constexpr auto get(const detail::Array<T, 0>&) noexcept
     return T{};
 }
 
+template <class T, std::size_t N>
+constexpr std::array<T, N> to_std_array(const detail::Array<T, N>& array) noexcept
+{
+    return array.array_;
+}
+
+template <class T>
+constexpr std::array<T, 0> to_std_array(const detail::Array<T, 0>&) noexcept
+{
+    return {};
+}
+
 template <std::size_t N, class T, std::size_t K, std::size_t... I>
 constexpr auto convert_array_to_size(const detail::Array<T, K>& array, std::index_sequence<I...>)
 {
@@ -7,13 +7,23 @@
 #define CNTGS_DETAIL_ELEMENTLOCATOR_HPP
 
 #include "cntgs/detail/elementTraits.hpp"
+#include "cntgs/detail/memory.hpp"
 #include "cntgs/detail/parameterListTraits.hpp"
 #include "cntgs/detail/typeTraits.hpp"
 #include "cntgs/detail/unmanagedVector.hpp"
 #include "cntgs/detail/utility.hpp"
+#include "cntgs/parameter.hpp"
 
 #include <algorithm>
+#include <cassert>
+#include <cstdlib>
 #include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 namespace cntgs::detail
 {
@@ -27,20 +37,51 @@ auto move_elements(std::size_t from, std::size_t to, std::byte* memory_begin, co
     return source - target;
 }
 
-inline std::byte* get_mixed_element_address(std::size_t index, std::byte* memory_begin,
-                                            const std::size_t element_addresses[]) noexcept
+template <class IndexType>
+std::byte* get_mixed_element_address(std::size_t index, std::byte* memory_begin,
+                                     const IndexType element_addresses[]) noexcept
 {
     return memory_begin + element_addresses[index];
 }
 
+template <class IndexType>
+constexpr bool is_within_index_range(std::size_t storage_size) noexcept
+{
+    return storage_size <= std::numeric_limits<IndexType>::max();
+}
+
+/// Called wherever the element storage is sized, so that the offsets stored by the index cannot be truncated later on
+template <class IndexType>
+constexpr void check_index_range(std::size_t storage_size)
+{
+    if (!detail::is_within_index_range<IndexType>(storage_size))
+    {
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+        throw std::length_error("element storage exceeds the range of the IndexType option");
+#else
+        std::abort();
+#endif
+    }
+}
+
+template <class IndexType, class Offset>
+constexpr IndexType to_element_offset(Offset offset) noexcept
+{
+    assert(detail::is_within_index_range<IndexType>(static_cast<std::size_t>(offset)) &&
+           "element offset exceeds the range of the IndexType option");
+    return static_cast<IndexType>(offset);
+}
+
+template <class IndexType>
 class IteratorMixedElementLocator;
 
+template <class IndexType>
 class BaseElementLocator
 {
   protected:
-    friend detail::IteratorMixedElementLocator;
+    friend detail::IteratorMixedElementLocator<IndexType>;
 
-    using ElementAddresses = UnmanagedVector<std::size_t>;
+    using ElementAddresses = UnmanagedVector<IndexType>;
 
     ElementAddresses element_addresses_{};
     std::byte* last_element_{};
@@ -48,14 +89,25 @@ class BaseElementLocator
     BaseElementLocator() = default;
 
     template <class Allocator>
-    explicit BaseElementLocator(const BaseElementLocator& locator, std::byte* old_memory_begin,
-                                std::size_t old_max_element_count, std::byte* new_memory_begin,
-                                std::size_t new_max_element_count, const Allocator& allocator)
+    explicit BaseElementLocator(const BaseElementLocator& locator, std::byte* old_memory_begin, std::size_t,
+                                std::byte* new_memory_begin, std::size_t new_max_element_count,
+                                const Allocator& allocator)
         : last_element_(new_memory_begin + (locator.last_element_ - old_memory_begin))
     {
         element_addresses_.reserve(new_max_element_count, allocator);
         std::copy(locator.element_addresses_.begin(), locator.element_addresses_.end(), element_addresses_.begin());
-        element_addresses_.resize_from_capacity(old_max_element_count);
+        element_addresses_.resize_from_capacity(locator.element_addresses_.size());
+    }
+
+    explicit BaseElementLocator(const BaseElementLocator& locator, std::byte* old_memory_begin,
+                                std::byte* new_memory_begin, IndexType* element_addresses) noexcept
+        : element_addresses_(element_addresses),
+          last_element_(new_memory_begin + (locator.last_element_ - old_memory_begin))
+    {
+        // the source index may overlap when the storage it resides in has been extended in place
+        std::memmove(element_addresses_.data(), locator.element_addresses_.data(),
+                     locator.element_addresses_.size() * sizeof(IndexType));
+        element_addresses_.resize_from_capacity(locator.element_addresses_.size());
     }
 
     template <class Allocator>
@@ -66,6 +118,11 @@ class BaseElementLocator
         element_addresses_.reserve(max_element_count, allocator);
     }
 
+    explicit BaseElementLocator(std::byte* last_element, IndexType* element_addresses) noexcept
+        : element_addresses_(element_addresses), last_element_(last_element)
+    {
+    }
+
     friend void swap(BaseElementLocator& lhs, BaseElementLocator& rhs) noexcept
     {
         std::swap(lhs.element_addresses_, rhs.element_addresses_);
@@ -75,9 +132,68 @@ class BaseElementLocator
   public:
     static constexpr auto reserved_bytes(std::size_t) noexcept { return std::size_t{}; }
 
+    static constexpr std::size_t index_memory_size(std::size_t max_element_count) noexcept
+    {
+        return alignof(IndexType) - 1 + max_element_count * sizeof(IndexType);
+    }
+
+    static IndexType* index_begin(std::byte* address) noexcept
+    {
+        return reinterpret_cast<IndexType*>(detail::align<alignof(IndexType)>(address));
+    }
+
+    /// Points the index at its new location after the allocation that contains it has been moved
+    void relocate_index(const std::byte* old_allocation_begin, std::byte* new_allocation_begin) noexcept
+    {
+        const auto offset = reinterpret_cast<const std::byte*>(element_addresses_.data()) - old_allocation_begin;
+        element_addresses_.relocate(reinterpret_cast<IndexType*>(new_allocation_begin + offset));
+    }
+
+    /// Points the last element at its new location after the element storage has been moved
+    void rebase(const std::byte* old_memory_begin, std::byte* new_memory_begin) noexcept
+    {
+        last_element_ = new_memory_begin + (last_element_ - old_memory_begin);
+    }
+
+    bool is_index_within(const std::byte* first, const std::byte* last) const noexcept
+    {
+        const auto index = reinterpret_cast<const std::byte*>(element_addresses_.data());
+        return std::less_equal<>{}(first, index) && std::less<>{}(index, last);
+    }
+
+    const std::byte* memory_end(const std::byte* allocation_begin, const std::byte* allocation_end) const noexcept
+    {
+        if (is_index_within(allocation_begin, allocation_end))
+        {
+            return reinterpret_cast<const std::byte*>(element_addresses_.data());
+        }
+        return allocation_end;
+    }
+
+    template <class Allocator>
+    void deallocate(std::size_t max_element_count, const std::byte* allocation_begin, const std::byte* allocation_end,
+                    const Allocator& allocator) noexcept
+    {
+        if (element_addresses_.data() != nullptr && !is_index_within(allocation_begin, allocation_end))
+        {
+            element_addresses_.deallocate(max_element_count, allocator);
+        }
+    }
+
     bool empty(const std::byte*) const noexcept { return element_addresses_.empty(); }
 
-    std::size_t memory_size() const noexcept { return element_addresses_.size() * sizeof(std::size_t); }
+    std::size_t memory_size() const noexcept { return element_addresses_.size() * sizeof(IndexType); }
+
+    IndexType* index_data() noexcept { return element_addresses_.data(); }
+
+    const IndexType* index_data() const noexcept { return element_addresses_.data(); }
+
+    /// Adopts the first `size` offsets that have been written to index_data() directly
+    void assign_index(std::size_t size, std::byte* last_element) noexcept
+    {
+        element_addresses_.resize_from_capacity(size);
+        last_element_ = last_element;
+    }
 
     std::size_t size(const std::byte*) const noexcept { return element_addresses_.size(); }
 
@@ -100,8 +216,11 @@ class BaseElementLocator
         std::transform(element_addresses_.begin() + from, element_addresses_.end(), element_addresses_.begin() + to,
                        [&](auto address)
                        {
-                           return address - diff;
+                           return static_cast<IndexType>(address - diff);
                        });
+        // resize reads the end of the new last element from the entry past it
+        element_addresses_[element_addresses_.size() - (from - to)] =
+            detail::to_element_offset<IndexType>(last_element_ - diff - memory_begin);
     }
 
     void make_room_for_last_element_at(std::size_t index, std::size_t size_of_element, std::byte* memory_begin) noexcept
@@ -110,33 +229,42 @@ class BaseElementLocator
         const auto target = source + size_of_element;
         const auto count = static_cast<std::size_t>(data_end(memory_begin) - source);
         std::memmove(target, source, count);
-        element_addresses_.put_back(data_end(memory_begin) - memory_begin);
+        element_addresses_.put_back(detail::to_element_offset<IndexType>(data_end(memory_begin) - memory_begin));
         const auto begin = element_addresses_.begin() + index + 1;
         std::transform(begin, element_addresses_.end(), begin,
                        [&](auto address)
                        {
-                           return address + size_of_element;
+                           return detail::to_element_offset<IndexType>(address + size_of_element);
                        });
     }
 };
 
-template <class... Parameter>
-class ElementLocator : public BaseElementLocator
+template <class IndexType, class... Parameter>
+class ElementLocator : public BaseElementLocator<IndexType>
 {
   private:
-    using Base = BaseElementLocator;
+    using Base = BaseElementLocator<IndexType>;
     using ElementTraits = detail::ElementTraitsT<Parameter...>;
     using FixedSizesArray = typename detail::ParameterListTraits<Parameter...>::FixedSizesArray;
 
   public:
     ElementLocator() = default;
 
+    using IteratorLocator = detail::IteratorMixedElementLocator<IndexType>;
+
     template <class Allocator>
-    ElementLocator(std::size_t max_element_count, std::byte* memory_begin, ElementSize, const Allocator& allocator)
+    ElementLocator(std::size_t max_element_count, std::byte* memory_begin, const FixedSizesArray&, ElementSize,
+                   const Allocator& allocator)
         : Base{memory_begin, max_element_count, allocator}
     {
     }
 
+    ElementLocator(std::size_t, std::byte* memory_begin, const FixedSizesArray&, ElementSize,
+                   IndexType* element_addresses) noexcept
+        : Base{memory_begin, element_addresses}
+    {
+    }
+
     template <class Allocator>
     ElementLocator(const ElementLocator& other, std::byte* old_memory_begin, std::size_t old_max_element_count,
                    std::byte* new_memory_begin, std::size_t max_element_count, const Allocator& allocator)
@@ -144,13 +272,19 @@ class ElementLocator : public BaseElementLocator
     {
     }
 
+    ElementLocator(const ElementLocator& other, std::byte* old_memory_begin, std::byte* new_memory_begin,
+                   IndexType* element_addresses) noexcept
+        : Base{other, old_memory_begin, new_memory_begin, element_addresses}
+    {
+    }
+
     template <class... Args>
     auto emplace_back(std::byte* memory_begin, const FixedSizesArray& fixed_sizes, Args&&... args)
     {
         const auto last_element = ElementTraits::align_for_first_parameter(this->last_element_);
         const auto new_last_element =
             ElementTraits::emplace_at(last_element, fixed_sizes, static_cast<Args&&>(args)...);
-        this->element_addresses_.put_back(last_element - memory_begin);
+        this->element_addresses_.put_back(detail::to_element_offset<IndexType>(last_element - memory_begin));
         this->last_element_ = new_last_element;
         return new_last_element;
     }
@@ -160,14 +294,16 @@ class ElementLocator : public BaseElementLocator
     {
         const auto element_addresses_begin = ElementTraits::emplace_at_aliased(
             memory_begin + this->element_addresses_[index], fixed_sizes, static_cast<Args&&>(args)...);
-        this->element_addresses_[index + 1] = element_addresses_begin - memory_begin;
+        this->element_addresses_[index + 1] =
+            detail::to_element_offset<IndexType>(element_addresses_begin - memory_begin);
         return element_addresses_begin;
     }
 
-    void trivially_copy_into(std::byte* CNTGS_RESTRICT old_memory_begin,
-                             std::byte* CNTGS_RESTRICT new_memory_begin) noexcept
+    void trivially_copy_into(const std::byte* CNTGS_RESTRICT old_memory_begin,
+                             std::byte* CNTGS_RESTRICT new_memory_begin) const noexcept
     {
-        trivially_copy_into(this->last_element_, old_memory_begin, new_memory_begin);
+        const auto memory_size = std::distance(old_memory_begin, static_cast<const std::byte*>(this->last_element_));
+        std::memcpy(new_memory_begin, old_memory_begin, memory_size);
     }
 
     static constexpr std::size_t calculate_new_memory_size(std::size_t max_element_count,
@@ -178,13 +314,328 @@ class ElementLocator : public BaseElementLocator
                                                            ElementTraits::calculate_element_size(fixed_sizes));
     }
 
+};
+
+template <std::size_t SampleStride, class IndexType, class... Parameter>
+class IteratorSampledElementLocator;
+
+template <std::size_t SampleStride, class IndexType, class... Parameter>
+class SampledElementLocator
+    : public BaseElementLocator<IndexType>,
+      private detail::EmptyBaseOptimization<typename detail::ParameterListTraits<Parameter...>::FixedSizesArray>
+{
   private:
-    void trivially_copy_into(std::byte* old_last_element, std::byte* CNTGS_RESTRICT old_memory_begin,
-                             std::byte* CNTGS_RESTRICT new_memory_begin) noexcept
+    friend detail::IteratorSampledElementLocator<SampleStride, IndexType, Parameter...>;
+
+    using Base = BaseElementLocator<IndexType>;
+    using ElementTraits = detail::ElementTraitsT<Parameter...>;
+    using FixedSizesArray = typename detail::ParameterListTraits<Parameter...>::FixedSizesArray;
+    using FixedSizesBase = detail::EmptyBaseOptimization<FixedSizesArray>;
+
+    std::size_t element_count_{};
+
+    static constexpr std::size_t sample_count(std::size_t element_count) noexcept
+    {
+        return (element_count + SampleStride - 1) / SampleStride;
+    }
+
+    const FixedSizesArray& fixed_sizes() const noexcept { return FixedSizesBase::get(); }
+
+    void update_samples(std::size_t first, std::size_t last, std::byte* address, std::byte* memory_begin) noexcept
+    {
+        for (auto i = first; i < last; ++i)
+        {
+            if (i % SampleStride == 0)
+            {
+                this->element_addresses_[i / SampleStride] =
+                    detail::to_element_offset<IndexType>(address - memory_begin);
+            }
+            address = next_element_address(address, fixed_sizes());
+        }
+    }
+
+  public:
+    using IteratorLocator = detail::IteratorSampledElementLocator<SampleStride, IndexType, Parameter...>;
+
+    SampledElementLocator() = default;
+
+    template <class Allocator>
+    SampledElementLocator(std::size_t max_element_count, std::byte* memory_begin, const FixedSizesArray& fixed_sizes,
+                          ElementSize, const Allocator& allocator)
+        : Base{memory_begin, sample_count(max_element_count), allocator}, FixedSizesBase{fixed_sizes}
+    {
+    }
+
+    SampledElementLocator(std::size_t, std::byte* memory_begin, const FixedSizesArray& fixed_sizes, ElementSize,
+                          IndexType* element_addresses) noexcept
+        : Base{memory_begin, element_addresses}, FixedSizesBase{fixed_sizes}
+    {
+    }
+
+    template <class Allocator>
+    SampledElementLocator(const SampledElementLocator& other, std::byte* old_memory_begin,
+                          std::size_t old_max_element_count, std::byte* new_memory_begin,
+                          std::size_t max_element_count, const Allocator& allocator)
+        : Base{other,
+               old_memory_begin,
+               sample_count(old_max_element_count),
+               new_memory_begin,
+               sample_count(max_element_count),
+               allocator},
+          FixedSizesBase{other.fixed_sizes()},
+          element_count_(other.element_count_)
+    {
+    }
+
+    SampledElementLocator(const SampledElementLocator& other, std::byte* old_memory_begin,
+                          std::byte* new_memory_begin, IndexType* element_addresses) noexcept
+        : Base{other, old_memory_begin, new_memory_begin, element_addresses},
+          FixedSizesBase{other.fixed_sizes()},
+          element_count_(other.element_count_)
+    {
+    }
+
+    SampledElementLocator(SampledElementLocator&& other) noexcept
+        : Base{std::move(other)},
+          FixedSizesBase{std::move(other)},
+          element_count_(std::exchange(other.element_count_, std::size_t{}))
+    {
+    }
+
+    SampledElementLocator& operator=(SampledElementLocator&& other) noexcept
+    {
+        Base::operator=(std::move(other));
+        FixedSizesBase::operator=(std::move(other));
+        element_count_ = std::exchange(other.element_count_, std::size_t{});
+        return *this;
+    }
+
+    friend void swap(SampledElementLocator& lhs, SampledElementLocator& rhs) noexcept
+    {
+        swap(static_cast<Base&>(lhs), static_cast<Base&>(rhs));
+        std::swap(static_cast<FixedSizesBase&>(lhs), static_cast<FixedSizesBase&>(rhs));
+        std::swap(lhs.element_count_, rhs.element_count_);
+    }
+
+    static constexpr std::size_t index_memory_size(std::size_t max_element_count) noexcept
+    {
+        return Base::index_memory_size(sample_count(max_element_count));
+    }
+
+    template <class Allocator>
+    void deallocate(std::size_t max_element_count, const std::byte* allocation_begin, const std::byte* allocation_end,
+                    const Allocator& allocator) noexcept
+    {
+        Base::deallocate(sample_count(max_element_count), allocation_begin, allocation_end, allocator);
+    }
+
+    constexpr bool empty(const std::byte*) const noexcept { return element_count_ == std::size_t{}; }
+
+    constexpr std::size_t size(const std::byte*) const noexcept { return element_count_; }
+
+    static std::byte* next_element_address(std::byte* address, const FixedSizesArray& fixed_sizes) noexcept
+    {
+        return ElementTraits::align_for_first_parameter(ElementTraits::element_end(address, fixed_sizes));
+    }
+
+    static std::byte* element_address(std::size_t index, std::byte* memory_begin, const IndexType samples[],
+                                      const FixedSizesArray& fixed_sizes) noexcept
+    {
+        auto address = detail::get_mixed_element_address(index / SampleStride, memory_begin, samples);
+        for (auto i = index % SampleStride; i != std::size_t{}; --i)
+        {
+            address = next_element_address(address, fixed_sizes);
+        }
+        return address;
+    }
+
+    std::byte* element_address(std::size_t index, std::byte* memory_begin) const noexcept
+    {
+        if (index == element_count_)
+        {
+            return this->last_element_;
+        }
+        return element_address(index, memory_begin, this->element_addresses_.data(), fixed_sizes());
+    }
+
+    void resize(std::size_t new_size, std::byte* memory_begin) noexcept
+    {
+        this->last_element_ =
+            new_size == std::size_t{}
+                ? memory_begin
+                : ElementTraits::element_end(element_address(new_size - 1, memory_begin), fixed_sizes());
+        element_count_ = new_size;
+        this->element_addresses_.resize_from_capacity(sample_count(new_size));
+    }
+
+    void move_elements_forward(std::size_t from, std::size_t to, std::byte* memory_begin) noexcept
+    {
+        const auto target = element_address(to, memory_begin);
+        detail::move_elements(from, to, memory_begin, *this);
+        update_samples(to, element_count_ - (from - to), target, memory_begin);
+    }
+
+    template <class Relocate>
+    void move_elements_forward(std::size_t from, std::size_t to, std::byte* memory_begin, Relocate relocate)
+    {
+        auto source = element_address(from, memory_begin);
+        auto target = element_address(to, memory_begin);
+        for (auto i = to; from != element_count_; ++i, (void)++from)
+        {
+            const auto next_source = next_element_address(source, fixed_sizes());
+            if (i % SampleStride == 0)
+            {
+                this->element_addresses_[i / SampleStride] =
+                    detail::to_element_offset<IndexType>(target - memory_begin);
+            }
+            target = ElementTraits::align_for_first_parameter(relocate(source, target));
+            source = next_source;
+        }
+    }
+
+    template <class... Args>
+    auto emplace_back(std::byte* memory_begin, const FixedSizesArray& fixed_sizes, Args&&... args)
+    {
+        const auto last_element = ElementTraits::align_for_first_parameter(this->last_element_);
+        const auto new_last_element =
+            ElementTraits::emplace_at(last_element, fixed_sizes, static_cast<Args&&>(args)...);
+        if (element_count_ % SampleStride == 0)
+        {
+            this->element_addresses_.put_back(detail::to_element_offset<IndexType>(last_element - memory_begin));
+        }
+        ++element_count_;
+        this->last_element_ = new_last_element;
+        return new_last_element;
+    }
+
+    void trivially_copy_into(const std::byte* CNTGS_RESTRICT old_memory_begin,
+                             std::byte* CNTGS_RESTRICT new_memory_begin) const noexcept
     {
-        const auto memory_size = std::distance(old_memory_begin, old_last_element);
+        const auto memory_size = std::distance(old_memory_begin, static_cast<const std::byte*>(this->last_element_));
         std::memcpy(new_memory_begin, old_memory_begin, memory_size);
-        this->last_element_ = new_memory_begin + memory_size;
+    }
+
+    static constexpr std::size_t calculate_new_memory_size(std::size_t max_element_count,
+                                                           std::size_t varying_size_bytes, std::size_t,
+                                                           const FixedSizesArray& fixed_sizes) noexcept
+    {
+        return ElementTraits::calculate_needed_memory_size(max_element_count, varying_size_bytes,
+                                                           ElementTraits::calculate_element_size(fixed_sizes));
+    }
+};
+
+template <class... Parameter>
+class ScanElementLocator
+{
+  private:
+    using ElementTraits = detail::ElementTraitsT<Parameter...>;
+    using FixedSizesArray = typename detail::ParameterListTraits<Parameter...>::FixedSizesArray;
+
+    std::size_t element_count_{};
+    std::byte* last_element_{};
+
+  public:
+    ScanElementLocator() = default;
+
+    ScanElementLocator(const ScanElementLocator&) = default;
+
+    constexpr ScanElementLocator(ScanElementLocator&& other) noexcept
+        : element_count_(std::exchange(other.element_count_, std::size_t{})), last_element_(other.last_element_)
+    {
+    }
+
+    ScanElementLocator& operator=(const ScanElementLocator&) = default;
+
+    constexpr ScanElementLocator& operator=(ScanElementLocator&& other) noexcept
+    {
+        element_count_ = std::exchange(other.element_count_, std::size_t{});
+        last_element_ = other.last_element_;
+        return *this;
+    }
+
+    template <class Allocator>
+    constexpr ScanElementLocator(std::size_t, std::byte* memory_begin, const FixedSizesArray&, ElementSize,
+                                 const Allocator&) noexcept
+        : last_element_(memory_begin)
+    {
+    }
+
+    template <class Allocator>
+    ScanElementLocator(const ScanElementLocator& other, std::byte* old_memory_begin, std::size_t,
+                       std::byte* new_memory_begin, std::size_t, const Allocator&) noexcept
+        : element_count_(other.element_count_),
+          last_element_(new_memory_begin + (other.last_element_ - old_memory_begin))
+    {
+    }
+
+    void rebase(const std::byte* old_memory_begin, std::byte* new_memory_begin) noexcept
+    {
+        last_element_ = new_memory_begin + (last_element_ - old_memory_begin);
+    }
+
+    static constexpr const std::byte* memory_end(const std::byte*, const std::byte* allocation_end) noexcept
+    {
+        return allocation_end;
+    }
+
+    template <class Allocator>
+    static constexpr void deallocate(std::size_t, const std::byte*, const std::byte*, const Allocator&) noexcept
+    {
+    }
+
+    constexpr bool empty(const std::byte*) const noexcept { return element_count_ == std::size_t{}; }
+
+    static constexpr std::size_t memory_size() noexcept { return {}; }
+
+    constexpr std::size_t size(const std::byte*) const noexcept { return element_count_; }
+
+    static std::byte* next_element_address(std::byte* address, const FixedSizesArray& fixed_sizes) noexcept
+    {
+        return ElementTraits::align_for_first_parameter(ElementTraits::element_end(address, fixed_sizes));
+    }
+
+    /// Without an index only the first and the past-the-end element can be located
+    std::byte* element_address([[maybe_unused]] std::size_t index, std::byte* memory_begin) const noexcept
+    {
+        assert(index == std::size_t{} || index == element_count_);
+        if (index == std::size_t{})
+        {
+            return ElementTraits::align_for_first_parameter(memory_begin);
+        }
+        return ElementTraits::align_for_first_parameter(last_element_);
+    }
+
+    constexpr auto data_end(const std::byte*) const noexcept { return last_element_; }
+
+    void resize([[maybe_unused]] std::size_t new_size, std::byte* memory_begin) noexcept
+    {
+        assert(new_size == std::size_t{});
+        last_element_ = memory_begin;
+        element_count_ = {};
+    }
+
+    template <class... Args>
+    auto emplace_back(std::byte*, const FixedSizesArray& fixed_sizes, Args&&... args)
+    {
+        const auto last_element = ElementTraits::align_for_first_parameter(last_element_);
+        last_element_ = ElementTraits::emplace_at(last_element, fixed_sizes, static_cast<Args&&>(args)...);
+        ++element_count_;
+        return last_element_;
+    }
+
+    void trivially_copy_into(const std::byte* CNTGS_RESTRICT old_memory_begin,
+                             std::byte* CNTGS_RESTRICT new_memory_begin) const noexcept
+    {
+        const auto memory_size = std::distance(old_memory_begin, static_cast<const std::byte*>(last_element_));
+        std::memcpy(new_memory_begin, old_memory_begin, memory_size);
+    }
+
+    static constexpr std::size_t calculate_new_memory_size(std::size_t max_element_count,
+                                                           std::size_t varying_size_bytes, std::size_t,
+                                                           const FixedSizesArray& fixed_sizes) noexcept
+    {
+        return ElementTraits::calculate_needed_memory_size(max_element_count, varying_size_bytes,
+                                                           ElementTraits::calculate_element_size(fixed_sizes));
     }
 };
 
@@ -202,12 +653,26 @@ class BaseAllFixedSizeElementLocator
     }
 
   public:
+    static constexpr void rebase(const std::byte*, std::byte*) noexcept {}
+
+    static constexpr const std::byte* memory_end(const std::byte*, const std::byte* allocation_end) noexcept
+    {
+        return allocation_end;
+    }
+
+    template <class Allocator>
+    static constexpr void deallocate(std::size_t, const std::byte*, const std::byte*, const Allocator&) noexcept
+    {
+    }
+
     constexpr bool empty(const std::byte*) const noexcept { return element_count_ == std::size_t{}; }
 
     static constexpr std::size_t memory_size() noexcept { return {}; }
 
     constexpr std::size_t size(const std::byte*) const noexcept { return element_count_; }
 
+    constexpr std::size_t stride() const noexcept { return stride_; }
+
     constexpr std::byte* element_address(std::size_t index, std::byte* memory_begin) const noexcept
     {
         return memory_begin + stride_ * index;
@@ -225,7 +690,7 @@ class BaseAllFixedSizeElementLocator
     void make_room_for_last_element_at(std::size_t from, std::size_t size_of_element,
                                        std::byte* memory_begin) const noexcept
     {
-        const auto source = element_address(from, {});
+        const auto source = element_address(from, memory_begin);
         const auto target = source + size_of_element;
         const auto count = static_cast<std::size_t>(data_end(memory_begin) - source);
         std::memmove(target, source, count);
@@ -240,10 +705,13 @@ class AllFixedSizeElementLocator : public BaseAllFixedSizeElementLocator
     using FixedSizesArray = typename detail::ParameterListTraits<Parameter...>::FixedSizesArray;
 
   public:
+    using IteratorLocator = detail::BaseAllFixedSizeElementLocator;
+
     AllFixedSizeElementLocator() = default;
 
     template <class Allocator>
-    constexpr AllFixedSizeElementLocator(std::size_t, std::byte*, ElementSize element_size, const Allocator&) noexcept
+    constexpr AllFixedSizeElementLocator(std::size_t, std::byte*, const FixedSizesArray&, ElementSize element_size,
+                                         const Allocator&) noexcept
         : BaseAllFixedSizeElementLocator({}, element_size.stride)
     {
     }
@@ -271,36 +739,105 @@ class AllFixedSizeElementLocator : public BaseAllFixedSizeElementLocator
                                                  static_cast<Args&&>(args)...);
     }
 
-    void trivially_copy_into(const std::byte* old_memory_begin, std::byte* new_memory_begin) noexcept
+    void trivially_copy_into(const std::byte* old_memory_begin, std::byte* new_memory_begin) const noexcept
     {
-        trivially_copy_into(*this, old_memory_begin, new_memory_begin);
+        std::memcpy(new_memory_begin, old_memory_begin, element_count_ * stride_);
     }
 
     constexpr std::size_t calculate_new_memory_size(std::size_t max_element_count, std::size_t varying_size_bytes,
-                                                    std::size_t distance_to_first, const FixedSizesArray&) noexcept
+                                                    std::size_t distance_to_first,
+                                                    const FixedSizesArray&) const noexcept
     {
         return distance_to_first + varying_size_bytes + stride_ * max_element_count;
     }
+};
 
-  private:
-    void trivially_copy_into(const AllFixedSizeElementLocator& old_locator, const std::byte* old_memory_begin,
-                             std::byte* new_memory_begin) noexcept
+template <class Locator>
+void prefetch_element(const Locator& locator, std::size_t index, std::byte* memory_begin,
+                      cntgs::PrefetchLocality locality) noexcept
+{
+    const auto element = locator.element_address(index, memory_begin);
+    if constexpr (std::is_base_of_v<detail::BaseAllFixedSizeElementLocator, Locator>)
     {
-        std::memcpy(new_memory_begin, old_memory_begin, old_locator.element_count_ * old_locator.stride_);
+        detail::prefetch(element, locator.stride(), locality);
     }
-};
+    else
+    {
+        // the size of an element with varying size parameters is stored within the element itself
+        detail::prefetch(element, detail::CACHE_LINE_SIZE, locality);
+    }
+}
 
-template <class... Parameter>
-using ElementLocatorT = detail::ConditionalT<detail::ParameterListTraits<Parameter...>::IS_FIXED_SIZE_OR_PLAIN,
-                                             AllFixedSizeElementLocator<Parameter...>, ElementLocator<Parameter...>>;
+// Loads the cache line that holds the offset of the element at `index`, locators without an index compute the address
+template <class Locator>
+void prefetch_element_offset(const Locator&, std::size_t) noexcept
+{
+}
 
-template <class... Parameter>
+template <class IndexType, class... Parameter>
+void prefetch_element_offset(const ElementLocator<IndexType, Parameter...>& locator, std::size_t index) noexcept
+{
+    detail::prefetch(reinterpret_cast<const std::byte*>(locator.index_data() + index), sizeof(IndexType),
+                     cntgs::PrefetchLocality::HIGH);
+}
+
+template <std::size_t SampleStride, class IndexType, class... Parameter>
+void prefetch_element_offset(const SampledElementLocator<SampleStride, IndexType, Parameter...>& locator,
+                             std::size_t index) noexcept
+{
+    detail::prefetch(reinterpret_cast<const std::byte*>(locator.index_data() + index / SampleStride),
+                     sizeof(IndexType), cntgs::PrefetchLocality::HIGH);
+}
+
+inline constexpr std::size_t FOR_EACH_INDEX_PREFETCH_DISTANCE = 8;
+
+// Software pipeline with three stages that are FOR_EACH_INDEX_PREFETCH_DISTANCE lookups apart: prefetch the offset of
+// an element, prefetch the element using the by then cached offset and finally invoke `function` with its address.
+// The cache misses of consecutive lookups therefore overlap instead of being paid one after another.
+template <class Locator, class Indices, class Function>
+void for_each_index(const Locator& locator, std::byte* memory_begin, const Indices& indices, Function&& function)
+{
+    const auto end = std::end(indices);
+    auto offset_it = std::begin(indices);
+    auto element_it = offset_it;
+    auto it = offset_it;
+    for (std::size_t step{}; it != end; ++step)
+    {
+        if (offset_it != end)
+        {
+            detail::prefetch_element_offset(locator, static_cast<std::size_t>(*offset_it));
+            ++offset_it;
+        }
+        if (step >= FOR_EACH_INDEX_PREFETCH_DISTANCE && element_it != end)
+        {
+            detail::prefetch_element(locator, static_cast<std::size_t>(*element_it), memory_begin,
+                                     cntgs::PrefetchLocality::HIGH);
+            ++element_it;
+        }
+        if (step >= 2 * FOR_EACH_INDEX_PREFETCH_DISTANCE)
+        {
+            function(locator.element_address(static_cast<std::size_t>(*it), memory_begin));
+            ++it;
+        }
+    }
+}
+
+template <class Options, class... Parameter>
+using ElementLocatorT = detail::ConditionalT<
+    detail::ParameterListTraits<Parameter...>::IS_FIXED_SIZE_OR_PLAIN, AllFixedSizeElementLocator<Parameter...>,
+    detail::ConditionalT<
+        Options::ScanOnly::value, ScanElementLocator<Parameter...>,
+        detail::ConditionalT<(Options::SampledIndex::STRIDE > 1),
+                             SampledElementLocator<Options::SampledIndex::STRIDE, typename Options::IndexType,
+                                                   Parameter...>,
+                             ElementLocator<typename Options::IndexType, Parameter...>>>>;
+
+template <class Locator, class... Parameter>
 class ElementLocatorAndFixedSizes
     : private detail::EmptyBaseOptimization<typename detail::ParameterListTraits<Parameter...>::FixedSizesArray>
 {
   private:
     using FixedSizesArray = typename detail::ParameterListTraits<Parameter...>::FixedSizesArray;
-    using Locator = detail::ElementLocatorT<Parameter...>;
     using Base = detail::EmptyBaseOptimization<FixedSizesArray>;
 
   public:
@@ -319,7 +856,15 @@ class ElementLocatorAndFixedSizes
     constexpr ElementLocatorAndFixedSizes(std::size_t max_element_count, std::byte* memory,
                                           const FixedSizesArray& fixed_sizes, ElementSize element_size,
                                           const Allocator& allocator) noexcept
-        : Base{fixed_sizes}, locator_(max_element_count, memory, element_size, allocator)
+        : Base{fixed_sizes}, locator_(max_element_count, memory, fixed_sizes, element_size, allocator)
+    {
+    }
+
+    template <class IndexType>
+    constexpr ElementLocatorAndFixedSizes(std::size_t max_element_count, std::byte* memory,
+                                          const FixedSizesArray& fixed_sizes, ElementSize element_size,
+                                          IndexType* element_addresses) noexcept
+        : Base{fixed_sizes}, locator_(max_element_count, memory, fixed_sizes, element_size, element_addresses)
     {
     }
 
@@ -332,6 +877,13 @@ class ElementLocatorAndFixedSizes
     {
     }
 
+    template <class IndexType>
+    ElementLocatorAndFixedSizes(const ElementLocatorAndFixedSizes& other, std::byte* old_memory_begin,
+                                std::byte* new_memory_begin, IndexType* element_addresses) noexcept
+        : Base{other.fixed_sizes()}, locator_{other.locator_, old_memory_begin, new_memory_begin, element_addresses}
+    {
+    }
+
     constexpr auto operator->() noexcept { return &locator_; }
 
     constexpr auto operator->() const noexcept { return &locator_; }
@@ -345,13 +897,14 @@ class ElementLocatorAndFixedSizes
     constexpr const auto& fixed_sizes() const noexcept { return Base::get(); }
 };
 
+template <class IndexType>
 class IteratorMixedElementLocator
 {
   private:
-    std::size_t* element_addresses_;
+    IndexType* element_addresses_;
 
   public:
-    explicit IteratorMixedElementLocator(BaseElementLocator& locator)
+    explicit IteratorMixedElementLocator(BaseElementLocator<IndexType>& locator)
         : element_addresses_(locator.element_addresses_.data())
     {
     }
@@ -362,14 +915,56 @@ class IteratorMixedElementLocator
     }
 };
 
-using IteratorAllFixedSizeElementLocator = BaseAllFixedSizeElementLocator;
+template <std::size_t SampleStride, class IndexType, class... Parameter>
+class IteratorSampledElementLocator
+    : private detail::EmptyBaseOptimization<typename detail::ParameterListTraits<Parameter...>::FixedSizesArray>
+{
+  private:
+    using Locator = detail::SampledElementLocator<SampleStride, IndexType, Parameter...>;
+    using Base = detail::EmptyBaseOptimization<typename detail::ParameterListTraits<Parameter...>::FixedSizesArray>;
+
+    IndexType* samples_{};
+    std::size_t element_count_{};
+    std::byte* last_element_{};
+
+  public:
+    IteratorSampledElementLocator() = default;
+
+    explicit IteratorSampledElementLocator(Locator& locator)
+        : Base{locator.fixed_sizes()},
+          samples_(locator.element_addresses_.data()),
+          element_count_(locator.element_count_),
+          last_element_(locator.last_element_)
+    {
+    }
+
+    const auto& fixed_sizes() const noexcept { return Base::get(); }
+
+    std::byte* element_address(std::size_t index, std::byte* memory_begin) const noexcept
+    {
+        // the end has no sample of its own when the size is a multiple of the stride
+        if (index == element_count_)
+        {
+            return last_element_;
+        }
+        return Locator::element_address(index, memory_begin, samples_, fixed_sizes());
+    }
+
+    /// Address of the element at `index` given the `address` of the element before it
+    std::byte* next_element_address(std::size_t index, std::byte* address) const noexcept
+    {
+        if (index == element_count_)
+        {
+            return last_element_;
+        }
+        return Locator::next_element_address(address, fixed_sizes());
+    }
+};
 
-template <bool IsAllFixedSize, class FixedSizesArray>
+template <class Locator, class FixedSizesArray>
 class IteratorElementLocatorAndFixedSizes : private detail::EmptyBaseOptimization<FixedSizesArray>
 {
   private:
-    using Locator =
-        detail::ConditionalT<IsAllFixedSize, IteratorAllFixedSizeElementLocator, IteratorMixedElementLocator>;
     using Base = detail::EmptyBaseOptimization<FixedSizesArray>;
 
   public:
@@ -377,8 +972,9 @@ class IteratorElementLocatorAndFixedSizes : private detail::EmptyBaseOptimizatio
 
     IteratorElementLocatorAndFixedSizes() = default;
 
-    template <class... Parameter>
-    constexpr IteratorElementLocatorAndFixedSizes(ElementLocatorAndFixedSizes<Parameter...>& locator) noexcept
+    template <class ElementLocator, class... Parameter>
+    constexpr IteratorElementLocatorAndFixedSizes(
+        ElementLocatorAndFixedSizes<ElementLocator, Parameter...>& locator) noexcept
         : Base{locator.fixed_sizes()}, locator_(locator.locator_)
     {
     }
@@ -20,6 +20,7 @@
 #include <array>
 #include <cstddef>
 #include <limits>
+#include <tuple>
 #include <type_traits>
 
 namespace cntgs::detail
@@ -231,6 +232,30 @@ class ElementTraits<std::index_sequence<I...>, Parameter...>
             address, SizeGetterType::template get<ParameterT, K>(fixed_sizes, result));
     }
 
+    template <std::size_t K, class Arguments>
+    static constexpr std::size_t value_count_of([[maybe_unused]] const FixedSizesArray& fixed_sizes,
+                                                [[maybe_unused]] const Arguments& arguments) noexcept
+    {
+        std::size_t count{1};
+        if constexpr (ParameterTraitsAt<K>::TYPE == detail::ParameterType::VARYING_SIZE)
+        {
+            count = static_cast<std::size_t>(std::get<(K - 1)>(arguments));
+        }
+        else if constexpr (ParameterTraitsAt<K>::TYPE == detail::ParameterType::FIXED_SIZE)
+        {
+            count = SizeGetter::template get_fixed_size<K>(fixed_sizes);
+        }
+        return count;
+    }
+
+    template <std::size_t K, class Arguments>
+    static constexpr std::size_t max_size_in_memory_of_one(const FixedSizesArray& fixed_sizes,
+                                                           const Arguments& arguments) noexcept
+    {
+        return ParameterTraitsAt<K>::ALIGNMENT - 1 +
+               ParameterTraitsAt<K>::VALUE_BYTES * ElementTraits::value_count_of<K>(fixed_sizes, arguments);
+    }
+
     static constexpr ElementSize calculate_element_size_all_fixed_size(const FixedSizesArray& fixed_sizes) noexcept
     {
         BackwardSizeInMemory backward{};
@@ -305,11 +330,16 @@ class ElementTraits<std::index_sequence<I...>, Parameter...>
 
     template <class StorageType, class Allocator>
     static constexpr StorageType allocate_memory(std::size_t size_in_bytes, const Allocator& allocator)
+    {
+        return StorageType(storage_element_count(size_in_bytes), allocator);
+    }
+
+    static constexpr std::size_t storage_element_count(std::size_t size_in_bytes) noexcept
     {
         const auto remainder = size_in_bytes % STORAGE_ELEMENT_ALIGNMENT;
         auto count = size_in_bytes / STORAGE_ELEMENT_ALIGNMENT;
         count += remainder == 0 ? 0 : 1;
-        return StorageType(count, allocator);
+        return count;
     }
 
     static constexpr std::byte* align_for_first_parameter(std::byte* address) noexcept
@@ -342,6 +372,15 @@ class ElementTraits<std::index_sequence<I...>, Parameter...>
         return result;
     }
 
+    static std::byte* element_end(std::byte* CNTGS_RESTRICT address,
+                                  const FixedSizesArray& CNTGS_RESTRICT fixed_sizes) noexcept
+    {
+        ContiguousPointer result;
+        ((std::tie(std::get<I>(result), address) = load_one<Parameter, I, SizeGetter>(address, fixed_sizes, result)),
+         ...);
+        return address;
+    }
+
     static constexpr ElementSize calculate_element_size(const FixedSizesArray& fixed_sizes) noexcept
     {
         if constexpr (FIRST_ELEMENT_HAS_OFFSET)
@@ -362,6 +401,28 @@ class ElementTraits<std::index_sequence<I...>, Parameter...>
         return distance_to_first + varying_size_bytes + element_stride * max_element_count - padding;
     }
 
+    template <class... Args>
+    static constexpr std::size_t max_size_in_memory_of(const FixedSizesArray& fixed_sizes,
+                                                       const Args&... args) noexcept
+    {
+        const auto arguments = std::forward_as_tuple(args...);
+        return STORAGE_ELEMENT_ALIGNMENT - 1 +
+               (ElementTraits::max_size_in_memory_of_one<I>(fixed_sizes, arguments) + ...);
+    }
+
+    /// Exact number of bytes that an element emplaced with `args` occupies when it starts at an address aligned to
+    /// STORAGE_ELEMENT_ALIGNMENT, including the padding up to the start of the next element
+    template <class... Args>
+    static constexpr std::size_t size_in_memory_of(const FixedSizesArray& fixed_sizes, const Args&... args) noexcept
+    {
+        const auto arguments = std::forward_as_tuple(args...);
+        std::uintptr_t offset{};
+        ((offset = detail::align<ParameterTraitsAt<I>::ALIGNMENT>(offset) +
+                   ParameterTraitsAt<I>::VALUE_BYTES * ElementTraits::value_count_of<I>(fixed_sizes, arguments)),
+         ...);
+        return static_cast<std::size_t>(detail::align<STORAGE_ELEMENT_ALIGNMENT>(offset));
+    }
+
     template <bool UseMove, bool IsConst>
     static constexpr void construct_if_non_trivial(const cntgs::BasicContiguousReference<IsConst, Parameter...>& source,
                                                    const ContiguousPointer& target)
@@ -0,0 +1,208 @@
+// Copyright (c) 2021 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef CNTGS_DETAIL_FILEFORMAT_HPP
+#define CNTGS_DETAIL_FILEFORMAT_HPP
+
+#include "cntgs/detail/elementLocator.hpp"
+#include "cntgs/detail/elementTraits.hpp"
+#include "cntgs/detail/memory.hpp"
+#include "cntgs/detail/parameterListTraits.hpp"
+#include "cntgs/detail/parameterTraits.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace cntgs::detail
+{
+inline constexpr std::array<char, 8> FILE_MAGIC{'c', 'n', 't', 'g', 's', 'v', 'e', 'c'};
+inline constexpr std::size_t FILE_VERSION = 1;
+inline constexpr std::size_t FILE_MAX_ALIGNMENT = 4096;
+
+template <class FixedSizesArray>
+struct FileHeader
+{
+    std::array<char, 8> magic;
+    std::size_t version;
+    std::uint64_t fingerprint;
+    std::size_t storage_alignment;
+    std::size_t element_count;
+    std::size_t storage_offset;
+    std::size_t storage_size;
+    std::size_t index_offset;
+    FixedSizesArray fixed_sizes;
+};
+
+inline constexpr std::uint64_t FINGERPRINT_OFFSET_BASIS = 14695981039346656037ULL;
+inline constexpr std::uint64_t FINGERPRINT_PRIME = 1099511628211ULL;
+
+constexpr std::uint64_t combine_fingerprint(std::uint64_t fingerprint, std::size_t value) noexcept
+{
+    for (std::size_t i{}; i < sizeof(value); ++i)
+    {
+        fingerprint ^= (value >> (i * 8)) & 0xFF;
+        fingerprint *= FINGERPRINT_PRIME;
+    }
+    return fingerprint;
+}
+
+template <class T>
+constexpr std::size_t value_category() noexcept
+{
+    return std::size_t{std::is_floating_point_v<T>} | std::size_t{std::is_integral_v<T>} << 1 |
+           std::size_t{std::is_signed_v<T>} << 2 | std::size_t{std::is_enum_v<T>} << 3;
+}
+
+template <class Parameter>
+constexpr std::uint64_t combine_parameter_fingerprint(std::uint64_t fingerprint) noexcept
+{
+    using Traits = detail::ParameterTraits<Parameter>;
+    fingerprint = detail::combine_fingerprint(fingerprint, static_cast<std::size_t>(Traits::TYPE));
+    fingerprint = detail::combine_fingerprint(fingerprint, Traits::ALIGNMENT);
+    fingerprint = detail::combine_fingerprint(fingerprint, Traits::VALUE_BYTES);
+    return detail::combine_fingerprint(fingerprint, detail::value_category<typename Traits::ValueType>());
+}
+
+/// Layout of a vector written by [cntgs::serialize](): a header followed by the element storage, aligned like the
+/// storage of a vector, and for vectors with [cntgs::VaryingSize]() parameters the element index, terminated by the
+/// offset of the end of the last element.
+template <class ParsedOptions, class... Parameter>
+struct FileFormat
+{
+    using ListTraits = detail::ParameterListTraits<Parameter...>;
+    using ElementTraits = detail::ElementTraitsT<Parameter...>;
+    using ElementLocator = detail::ElementLocatorT<ParsedOptions, Parameter...>;
+    using ElementLocatorAndFixedSizes = detail::ElementLocatorAndFixedSizes<ElementLocator, Parameter...>;
+    using FixedSizesArray = typename ListTraits::FixedSizesArray;
+    using IndexType = typename ParsedOptions::IndexType;
+    using Header = detail::FileHeader<FixedSizesArray>;
+
+    static constexpr bool HAS_INDEX = !ListTraits::IS_FIXED_SIZE_OR_PLAIN;
+    static constexpr std::size_t INDEX_TYPE_SIZE = HAS_INDEX ? sizeof(IndexType) : std::size_t{};
+    static constexpr std::size_t STORAGE_ALIGNMENT = alignof(typename ElementTraits::StorageElementType);
+    static constexpr std::uint64_t FINGERPRINT = []
+    {
+        auto fingerprint = detail::combine_fingerprint(FINGERPRINT_OFFSET_BASIS, sizeof(std::size_t));
+        fingerprint = detail::combine_fingerprint(fingerprint, INDEX_TYPE_SIZE);
+        ((fingerprint = detail::combine_parameter_fingerprint<Parameter>(fingerprint)), ...);
+        return fingerprint;
+    }();
+
+    static_assert(ListTraits::IS_TRIVIALLY_COPY_CONSTRUCTIBLE && ListTraits::IS_TRIVIALLY_DESTRUCTIBLE,
+                  "only vectors of trivially copyable parameters can be serialized");
+    static_assert(!HAS_INDEX || (!ParsedOptions::ScanOnly::value && ParsedOptions::SampledIndex::STRIDE <= 1),
+                  "ScanOnly and SampledIndex vectors cannot be serialized");
+    static_assert(STORAGE_ALIGNMENT <= FILE_MAX_ALIGNMENT, "alignment exceeds the page alignment of a mapped file");
+
+    static constexpr std::size_t storage_offset(const FixedSizesArray& fixed_sizes) noexcept
+    {
+        // preserves the alignment of the first element relative to the storage of a vector
+        std::size_t distance_to_first{};
+        if constexpr (ElementTraits::FIRST_ELEMENT_HAS_OFFSET)
+        {
+            distance_to_first = ElementTraits::calculate_element_size(fixed_sizes).distance_to_first;
+        }
+        return detail::align(sizeof(Header), STORAGE_ALIGNMENT) + distance_to_first % STORAGE_ALIGNMENT;
+    }
+
+    static constexpr Header make_header(std::size_t element_count, std::size_t storage_size,
+                                        const FixedSizesArray& fixed_sizes) noexcept
+    {
+        Header header{};
+        header.magic = FILE_MAGIC;
+        header.version = FILE_VERSION;
+        header.fingerprint = FINGERPRINT;
+        header.storage_alignment = STORAGE_ALIGNMENT;
+        header.element_count = element_count;
+        header.storage_offset = storage_offset(fixed_sizes);
+        header.storage_size = storage_size;
+        header.index_offset = header.storage_offset + storage_size;
+        if constexpr (HAS_INDEX)
+        {
+            header.index_offset = detail::align(header.index_offset, alignof(IndexType));
+        }
+        header.fixed_sizes = fixed_sizes;
+        return header;
+    }
+
+    /// Number of bytes from the beginning of the header to the end of the file, saturates at the largest `std::size_t`
+    /// for a corrupt header
+    static constexpr std::size_t file_size(const Header& header) noexcept
+    {
+        constexpr auto MAX_SIZE = (std::numeric_limits<std::size_t>::max)();
+        if constexpr (HAS_INDEX)
+        {
+            if (header.element_count >= (MAX_SIZE - header.index_offset) / sizeof(IndexType))
+            {
+                return MAX_SIZE;
+            }
+            return header.index_offset + (header.element_count + 1) * sizeof(IndexType);
+        }
+        else
+        {
+            return header.index_offset;
+        }
+    }
+
+    /// Every element occupies at least its fixed part of the element storage. Bounding the element count by the
+    /// storage size prevents a corrupt count from allocating an arbitrarily large vector.
+    static constexpr bool fits_into_storage(const Header& header) noexcept
+    {
+        const auto [size, stride, distance_to_first] = ElementTraits::calculate_element_size(header.fixed_sizes);
+        (void)distance_to_first;
+        if (header.element_count == std::size_t{} || stride == std::size_t{})
+        {
+            // only elements without a size parameter can be empty, those do not have an index
+            return true;
+        }
+        return size <= header.storage_size && header.element_count - 1 <= (header.storage_size - size) / stride;
+    }
+
+    /// Checks that the `element_count` offsets of an index read from a file are non-decreasing and within the element
+    /// storage
+    static constexpr bool is_valid_index(const IndexType* index, std::size_t element_count,
+                                         std::size_t storage_size) noexcept
+    {
+        IndexType previous{};
+        for (std::size_t i{}; i < element_count; ++i)
+        {
+            if (index[i] < previous || index[i] > storage_size)
+            {
+                return false;
+            }
+            previous = index[i];
+        }
+        return true;
+    }
+
+    /// Checks whether the header describes a file written from a vector with the same parameters. Only the header is
+    /// inspected, whether the file is as large as the header claims must be verified by the reader.
+    static constexpr bool is_compatible(const Header& header) noexcept
+    {
+        if (header.magic != FILE_MAGIC || header.version != FILE_VERSION || header.fingerprint != FINGERPRINT ||
+            header.storage_alignment != STORAGE_ALIGNMENT ||
+            header.storage_offset != FileFormat::storage_offset(header.fixed_sizes) ||
+            header.index_offset < header.storage_offset ||
+            header.storage_size > header.index_offset - header.storage_offset || !FileFormat::fits_into_storage(header))
+        {
+            return false;
+        }
+        if constexpr (HAS_INDEX)
+        {
+            return header.index_offset % alignof(IndexType) == 0;
+        }
+        else
+        {
+            return header.storage_size ==
+                   header.element_count * ElementTraits::calculate_element_size(header.fixed_sizes).stride;
+        }
+    }
+};
+}  // namespace cntgs::detail
+
+#endif  // CNTGS_DETAIL_FILEFORMAT_HPP
@@ -25,17 +25,45 @@ struct Options;
 template <class T>
 struct Allocator;
 
+template <std::size_t Numerator, std::size_t Denominator = 1>
+struct GrowthFactor;
+
+template <class T>
+struct IndexType;
+
+struct ScanOnly;
+
+template <std::size_t Stride>
+struct SampledIndex;
+
+struct CoLocatedIndex;
+
 template <class Options, class... T>
 class BasicContiguousVector;
 
 template <bool IsConst, class Options, class... Parameter>
 class ContiguousVectorIterator;
 
+template <bool IsConst, class Options, class... Parameter>
+class ContiguousVectorScanIterator;
+
+template <bool IsConst, class Options, class... Parameter>
+class ContiguousVectorSampledIterator;
+
 template <bool IsConst, class... Parameter>
 class BasicContiguousReference;
 
 template <class Allocator, class... Parameter>
 class BasicContiguousElement;
+
+template <class Options, class... Parameter>
+class BasicContiguousVectorView;
+
+template <class Vector>
+class MappedContiguousVector;
+
+template <class Options, class... Parameter>
+class BasicContiguousFileWriter;
 }  // namespace cntgs
 
 #endif  // CNTGS_DETAIL_FORWARD_HPP
@@ -10,6 +10,7 @@
 #include "cntgs/detail/iterator.hpp"
 #include "cntgs/detail/range.hpp"
 #include "cntgs/detail/typeTraits.hpp"
+#include "cntgs/parameter.hpp"
 
 #include <algorithm>
 #include <cstddef>
@@ -18,6 +19,10 @@
 #include <limits>
 #include <memory>
 
+#if defined(_MSC_VER) && !defined(__clang__) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
 namespace cntgs::detail
 {
 using Byte = unsigned char;
@@ -236,6 +241,50 @@ template <class T>
 }
 
 inline constexpr auto SIZE_T_TRAILING_ALIGNMENT = detail::trailing_alignment(sizeof(std::size_t), alignof(std::size_t));
+
+inline constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+template <cntgs::PrefetchLocality Locality>
+void prefetch_cache_line([[maybe_unused]] const void* address) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address, 0, static_cast<int>(Locality));
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    constexpr int HINTS[]{_MM_HINT_NTA, _MM_HINT_T2, _MM_HINT_T1, _MM_HINT_T0};
+    _mm_prefetch(static_cast<const char*>(address), HINTS[static_cast<int>(Locality)]);
+#endif
+}
+
+template <cntgs::PrefetchLocality Locality>
+void prefetch_cache_lines(const std::byte* address, std::size_t size) noexcept
+{
+    const auto end = reinterpret_cast<std::uintptr_t>(address) + size;
+    for (auto line = detail::align_down(reinterpret_cast<std::uintptr_t>(address), CACHE_LINE_SIZE); line < end;
+         line += CACHE_LINE_SIZE)
+    {
+        detail::prefetch_cache_line<Locality>(reinterpret_cast<const void*>(line));
+    }
+}
+
+/// Prefetches every cache line that overlaps with [address, address + size)
+inline void prefetch(const std::byte* address, std::size_t size, cntgs::PrefetchLocality locality) noexcept
+{
+    switch (locality)
+    {
+        case cntgs::PrefetchLocality::NONE:
+            detail::prefetch_cache_lines<cntgs::PrefetchLocality::NONE>(address, size);
+            break;
+        case cntgs::PrefetchLocality::LOW:
+            detail::prefetch_cache_lines<cntgs::PrefetchLocality::LOW>(address, size);
+            break;
+        case cntgs::PrefetchLocality::MODERATE:
+            detail::prefetch_cache_lines<cntgs::PrefetchLocality::MODERATE>(address, size);
+            break;
+        default:
+            detail::prefetch_cache_lines<cntgs::PrefetchLocality::HIGH>(address, size);
+            break;
+    }
+}
 }  // namespace cntgs::detail
 
 #endif  // CNTGS_DETAIL_MEMORY_HPP
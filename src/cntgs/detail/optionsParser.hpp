@@ -6,9 +6,11 @@
 #ifndef CNTGS_DETAIL_OPTIONSPARSER_HPP
 #define CNTGS_DETAIL_OPTIONSPARSER_HPP
 
+#include "cntgs/detail/forward.hpp"
 #include "cntgs/detail/typeTraits.hpp"
 #include "cntgs/parameter.hpp"
 
+#include <cstddef>
 #include <memory>
 #include <type_traits>
 
@@ -26,6 +28,71 @@ struct AllocatorOptionParser<cntgs::Allocator<T>> : std::true_type
     using Allocator = typename std::allocator_traits<T>::template rebind_alloc<std::byte>;
 };
 
+template <class = void>
+struct GrowthFactorOptionParser : std::false_type
+{
+    static constexpr std::size_t NUMERATOR{1};
+    static constexpr std::size_t DENOMINATOR{1};
+};
+
+template <std::size_t Numerator, std::size_t Denominator>
+struct GrowthFactorOptionParser<cntgs::GrowthFactor<Numerator, Denominator>> : std::true_type
+{
+    static_assert(Denominator != 0 && Numerator > Denominator, "GrowthFactor must be greater than one");
+
+    static constexpr std::size_t NUMERATOR{Numerator};
+    static constexpr std::size_t DENOMINATOR{Denominator};
+};
+
+template <class = void>
+struct IndexTypeOptionParser : std::false_type
+{
+    using IndexType = std::size_t;
+};
+
+template <class T>
+struct IndexTypeOptionParser<cntgs::IndexType<T>> : std::true_type
+{
+    static_assert(std::is_integral_v<T> && std::is_unsigned_v<T> && !std::is_same_v<T, bool>,
+                  "IndexType must be an unsigned integral type");
+
+    using IndexType = T;
+};
+
+template <class = void>
+struct ScanOnlyOptionParser : std::false_type
+{
+};
+
+template <>
+struct ScanOnlyOptionParser<cntgs::ScanOnly> : std::true_type
+{
+};
+
+template <class = void>
+struct CoLocatedIndexOptionParser : std::false_type
+{
+};
+
+template <>
+struct CoLocatedIndexOptionParser<cntgs::CoLocatedIndex> : std::true_type
+{
+};
+
+template <class = void>
+struct SampledIndexOptionParser : std::false_type
+{
+    static constexpr std::size_t STRIDE{1};
+};
+
+template <std::size_t Stride>
+struct SampledIndexOptionParser<cntgs::SampledIndex<Stride>> : std::true_type
+{
+    static_assert(Stride != 0, "SampledIndex stride must be greater than zero");
+
+    static constexpr std::size_t STRIDE{Stride};
+};
+
 template <class... Option>
 struct OptionsParser
 {
@@ -34,6 +101,16 @@ struct OptionsParser
         detail::ConditionalT<std::disjunction<Parser<Option>...>::value, std::disjunction<Parser<Option>...>, Parser<>>;
 
     using Allocator = typename Parse<detail::AllocatorOptionParser>::Allocator;
+
+    using GrowthFactor = Parse<detail::GrowthFactorOptionParser>;
+
+    using IndexType = typename Parse<detail::IndexTypeOptionParser>::IndexType;
+
+    using ScanOnly = Parse<detail::ScanOnlyOptionParser>;
+
+    using SampledIndex = Parse<detail::SampledIndexOptionParser>;
+
+    using CoLocatedIndex = Parse<detail::CoLocatedIndexOptionParser>;
 };
 }  // namespace cntgs::detail
 
@@ -10,6 +10,7 @@
 #include "cntgs/detail/parameterTraits.hpp"
 #include "cntgs/detail/parameterType.hpp"
 #include "cntgs/detail/typeTraits.hpp"
+#include "cntgs/typeTraits.hpp"
 
 #include <array>
 #include <cstddef>
@@ -55,6 +56,8 @@ struct ParameterListTraits
         (std::is_trivially_copy_assignable_v<typename detail::ParameterTraits<Parameter>::ValueType> && ...);
     static constexpr auto IS_TRIVIALLY_MOVE_ASSIGNABLE =
         (std::is_trivially_move_assignable_v<typename detail::ParameterTraits<Parameter>::ValueType> && ...);
+    static constexpr auto IS_TRIVIALLY_RELOCATABLE =
+        (cntgs::is_trivially_relocatable_v<typename detail::ParameterTraits<Parameter>::ValueType> && ...);
     static constexpr auto IS_TRIVIALLY_SWAPPABLE =
         (detail::IS_TRIVIALLY_SWAPPABLE<typename detail::ParameterTraits<Parameter>::ValueType> && ...);
     static constexpr auto IS_EQUALITY_MEMCMPABLE =
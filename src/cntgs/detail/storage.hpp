@@ -53,6 +53,14 @@ class Storage : public AllocatorAwarePointer<Allocator>
         add_offset(offset);
     }
 
+    bool reallocate(std::size_t new_size) noexcept
+    {
+        const auto offset = restore_ptr();
+        const auto reallocated = Base::reallocate(new_size);
+        add_offset(offset);
+        return reallocated;
+    }
+
     void add_offset(std::ptrdiff_t offset)
     {
         Base::get() = reinterpret_cast<typename Base::pointer>(reinterpret_cast<std::byte*>(Base::get()) + offset);
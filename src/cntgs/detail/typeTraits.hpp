@@ -7,6 +7,7 @@
 #define CNTGS_DETAIL_TYPETRAITS_HPP
 
 #include <cstddef>
+#include <memory>
 #include <type_traits>
 #include <utility>
 #include <version>
@@ -96,6 +97,15 @@ struct Conditional<false>
 template <bool B, class T, class U>
 using ConditionalT = typename detail::Conditional<B>::template Type<T, U>;
 
+template <class Allocator, class = void>
+inline constexpr bool HAS_REALLOCATE = false;
+
+template <class Allocator>
+inline constexpr bool
+    HAS_REALLOCATE<Allocator, std::void_t<decltype(std::declval<Allocator&>().reallocate(
+                                  std::declval<typename std::allocator_traits<Allocator>::pointer>(), std::size_t{},
+                                  std::size_t{}))>> = true;
+
 template <class Lhs, class Rhs, class = void>
 inline constexpr bool ARE_EQUALITY_COMPARABLE = false;
 
@@ -20,6 +20,8 @@ class UnmanagedVector
   public:
     UnmanagedVector() = default;
 
+    constexpr explicit UnmanagedVector(T* data) noexcept : data_(data) {}
+
     UnmanagedVector(const UnmanagedVector& other) = delete;
 
     constexpr UnmanagedVector(UnmanagedVector&& other) noexcept
@@ -50,6 +52,8 @@ class UnmanagedVector
 
     constexpr void resize_from_capacity(std::size_t new_size) noexcept { size_ = new_size; }
 
+    constexpr void relocate(T* data) noexcept { data_ = data; }
+
     constexpr void put_back(T&& value) noexcept
     {
         data_[size_] = std::move(value);
@@ -68,6 +72,16 @@ class UnmanagedVector
         }
         data_ = new_mem;
     }
+
+    template <class Allocator>
+    constexpr void deallocate(std::size_t capacity, const Allocator& allocator) noexcept
+    {
+        using Traits = RebindTraits<Allocator, T>;
+        typename Traits::allocator_type alloc(allocator);
+        Traits::deallocate(alloc, data_, capacity);
+        data_ = nullptr;
+        size_ = 0;
+    }
 };
 }  // namespace cntgs::detail
 
@@ -0,0 +1,223 @@
+// Copyright (c) 2021 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef CNTGS_CNTGS_FILEWRITER_HPP
+#define CNTGS_CNTGS_FILEWRITER_HPP
+
+#include "cntgs/detail/elementLocator.hpp"
+#include "cntgs/detail/fileFormat.hpp"
+#include "cntgs/detail/forward.hpp"
+#include "cntgs/detail/memory.hpp"
+#include "cntgs/detail/optionsParser.hpp"
+#include "cntgs/detail/parameterListTraits.hpp"
+#include "cntgs/serialize.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace cntgs
+{
+/// Alias template for [cntgs::BasicContiguousFileWriter]() without options
+template <class... Parameter>
+using ContiguousFileWriter = cntgs::BasicContiguousFileWriter<cntgs::Options<>, Parameter...>;
+
+/// Writes elements sequentially to a file in the format of [cntgs::serialize]() without holding the vector in memory.
+/// Each element is laid out into a write buffer exactly like [cntgs::BasicContiguousVector::emplace_back]() would lay
+/// it out in the vector and the buffer is appended to the file whenever it is full. For parameter lists with
+/// [cntgs::VaryingSize]() parameters the element index is collected in memory and written as a trailer. The header is
+/// written last by [cntgs::BasicContiguousFileWriter::close](). The resulting file can be read with
+/// [cntgs::deserialize]() or mapped with [cntgs::MappedContiguousVector]().
+///
+/// \param Option Any of the options of [cntgs::BasicContiguousVector](), only [cntgs::IndexType]() affects the file.
+/// \param Parameter The parameters of the vector that the file will be read into
+template <class... Option, class... Parameter>
+class BasicContiguousFileWriter<cntgs::Options<Option...>, Parameter...>
+{
+  private:
+    using Format = detail::FileFormat<detail::OptionsParser<Option...>, Parameter...>;
+    using ListTraits = typename Format::ListTraits;
+    using ElementTraits = typename Format::ElementTraits;
+    using StorageElementType = typename ElementTraits::StorageElementType;
+    using FixedSizes = typename ListTraits::FixedSizes;
+    using FixedSizesArray = typename ListTraits::FixedSizesArray;
+    using IndexType = typename Format::IndexType;
+
+    static constexpr std::size_t DEFAULT_BUFFER_SIZE = std::size_t{1} << 20;
+
+  public:
+    using size_type = std::size_t;
+
+    BasicContiguousFileWriter() = default;
+
+    /// Creates or truncates the file at `path`. The writer remains closed if the file cannot be opened.
+    ///
+    /// \param buffer_size Number of bytes that are collected before they are appended to the file. The buffer grows
+    /// when a single element does not fit into it.
+    explicit BasicContiguousFileWriter(const char* path, const FixedSizes& fixed_sizes = {},
+                                       size_type buffer_size = DEFAULT_BUFFER_SIZE)
+        : file_(path, std::ios::binary | std::ios::trunc),
+          fixed_sizes_{fixed_sizes},
+          stride_(ElementTraits::calculate_element_size(fixed_sizes_).stride),
+          storage_offset_(Format::storage_offset(fixed_sizes_))
+    {
+        // the buffer begins at an aligned file offset so that elements are aligned like in a vector
+        buffer_offset_ = detail::align_down(storage_offset_, Format::STORAGE_ALIGNMENT);
+        allocate_buffer(buffer_size);
+        last_element_ = buffer_begin() + (storage_offset_ - buffer_offset_);
+        std::fill(buffer_begin(), last_element_, std::byte{});
+        detail::write_padding(file_, buffer_offset_);
+    }
+
+    BasicContiguousFileWriter(const BasicContiguousFileWriter&) = delete;
+
+    BasicContiguousFileWriter(BasicContiguousFileWriter&&) = default;
+
+    BasicContiguousFileWriter& operator=(const BasicContiguousFileWriter&) = delete;
+
+    BasicContiguousFileWriter& operator=(BasicContiguousFileWriter&& other) noexcept
+    {
+        if (this != &other)
+        {
+            close();
+            file_ = std::move(other.file_);
+            fixed_sizes_ = other.fixed_sizes_;
+            stride_ = other.stride_;
+            storage_offset_ = other.storage_offset_;
+            buffer_offset_ = other.buffer_offset_;
+            buffer_ = std::move(other.buffer_);
+            buffer_size_ = std::exchange(other.buffer_size_, {});
+            last_element_ = std::exchange(other.last_element_, nullptr);
+            element_count_ = std::exchange(other.element_count_, {});
+            index_ = std::move(other.index_);
+        }
+        return *this;
+    }
+
+    ~BasicContiguousFileWriter() noexcept { close(); }
+
+    [[nodiscard]] bool is_open() const noexcept { return file_.is_open(); }
+
+    /// Number of elements written so far
+    [[nodiscard]] size_type size() const noexcept { return element_count_; }
+
+    /// Throws `std::length_error` if the element storage would exceed the range of the [cntgs::IndexType]() option
+    template <class... Args>
+    void emplace_back(Args&&... args)
+    {
+        if constexpr (Format::HAS_INDEX)
+        {
+            const auto max_size = ElementTraits::max_size_in_memory_of(fixed_sizes_, args...);
+            detail::check_index_range<IndexType>(storage_size_at(last_element_) + max_size);
+            reserve_in_buffer(max_size);
+            const auto element = ElementTraits::align_for_first_parameter(last_element_);
+            std::fill(last_element_, element, std::byte{});
+            index_.push_back(detail::to_element_offset<IndexType>(storage_size_at(element)));
+            last_element_ = ElementTraits::emplace_at(element, fixed_sizes_, static_cast<Args&&>(args)...);
+        }
+        else
+        {
+            reserve_in_buffer(stride_);
+            const auto element_end =
+                ElementTraits::emplace_at(last_element_, fixed_sizes_, static_cast<Args&&>(args)...);
+            last_element_ += stride_;
+            std::fill(element_end, last_element_, std::byte{});
+        }
+        ++element_count_;
+    }
+
+    /// Appends the remaining elements and the element index to the file and writes the header. Called by the
+    /// destructor if needed.
+    ///
+    /// \returns Whether the file has been written successfully
+    bool close()
+    {
+        if (!file_.is_open())
+        {
+            return false;
+        }
+        const auto storage_size = storage_size_at(last_element_);
+        const auto header = Format::make_header(element_count_, storage_size, fixed_sizes_);
+        write_buffer(static_cast<size_type>(last_element_ - buffer_begin()));
+        if constexpr (Format::HAS_INDEX)
+        {
+            const auto end_offset = detail::to_element_offset<IndexType>(storage_size);
+            detail::write_padding(file_, header.index_offset - header.storage_offset - storage_size);
+            file_.write(reinterpret_cast<const char*>(index_.data()),
+                        static_cast<std::streamsize>(index_.size() * sizeof(IndexType)));
+            file_.write(reinterpret_cast<const char*>(&end_offset), sizeof(end_offset));
+            index_ = {};
+        }
+        file_.seekp(0);
+        file_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        const bool is_written = static_cast<bool>(file_.flush());
+        file_.close();
+        buffer_.reset();
+        return is_written;
+    }
+
+  private:
+    std::byte* buffer_begin() const noexcept { return reinterpret_cast<std::byte*>(buffer_.get()); }
+
+    size_type storage_size_at(const std::byte* address) const noexcept
+    {
+        return buffer_offset_ + static_cast<size_type>(address - buffer_begin()) - storage_offset_;
+    }
+
+    void allocate_buffer(size_type size)
+    {
+        const auto count = ElementTraits::storage_element_count(size);
+        buffer_ = std::make_unique<StorageElementType[]>(count);
+        buffer_size_ = count * sizeof(StorageElementType);
+    }
+
+    void write_buffer(size_type size)
+    {
+        file_.write(reinterpret_cast<const char*>(buffer_begin()), static_cast<std::streamsize>(size));
+        buffer_offset_ += size;
+    }
+
+    void reserve_in_buffer(size_type size)
+    {
+        if (static_cast<size_type>(buffer_begin() + buffer_size_ - last_element_) >= size)
+        {
+            return;
+        }
+        // keep the unaligned remainder in the buffer to preserve the alignment of the next element
+        const auto used_size = static_cast<size_type>(last_element_ - buffer_begin());
+        const auto written_size = detail::align_down(used_size, Format::STORAGE_ALIGNMENT);
+        write_buffer(written_size);
+        const auto remaining_size = used_size - written_size;
+        if (buffer_size_ - remaining_size < size)
+        {
+            auto old_buffer = std::move(buffer_);
+            allocate_buffer(remaining_size + size);
+            std::memcpy(buffer_begin(), old_buffer.get() + written_size / sizeof(StorageElementType), remaining_size);
+        }
+        else
+        {
+            std::memmove(buffer_begin(), buffer_begin() + written_size, remaining_size);
+        }
+        last_element_ = buffer_begin() + remaining_size;
+    }
+
+    std::ofstream file_;
+    FixedSizesArray fixed_sizes_{};
+    size_type stride_{};
+    size_type storage_offset_{};
+    size_type buffer_offset_{};
+    std::unique_ptr<StorageElementType[]> buffer_;
+    size_type buffer_size_{};
+    std::byte* last_element_{};
+    size_type element_count_{};
+    std::vector<IndexType> index_;
+};
+}  // namespace cntgs
+
+#endif  // CNTGS_CNTGS_FILEWRITER_HPP
@@ -20,9 +20,9 @@ class ContiguousVectorIterator
 {
   private:
     using Vector = cntgs::BasicContiguousVector<Options, Parameter...>;
-    using ElementLocatorAndFixedSizes = detail::IteratorElementLocatorAndFixedSizes<
-        detail::ParameterListTraits<Parameter...>::IS_FIXED_SIZE_OR_PLAIN,
-        typename detail::ParameterListTraits<Parameter...>::FixedSizesArray>;
+    using FixedSizesArray = typename detail::ParameterListTraits<Parameter...>::FixedSizesArray;
+    using ElementLocatorAndFixedSizes =
+        detail::IteratorElementLocatorAndFixedSizes<typename Vector::ElementLocator::IteratorLocator, FixedSizesArray>;
     using SizeType = typename Vector::size_type;
     using StoragePointer = typename std::allocator_traits<
         typename std::allocator_traits<typename Vector::allocator_type>::template rebind_alloc<std::byte>>::pointer;
@@ -46,6 +46,13 @@ class ContiguousVectorIterator
     {
     }
 
+    template <class Locator>
+    constexpr ContiguousVectorIterator(detail::ElementLocatorAndFixedSizes<Locator, Parameter...>& locator,
+                                       StoragePointer memory, SizeType index) noexcept
+        : i_(index), memory_(memory), locator_(locator)
+    {
+    }
+
     template <bool OtherIsConst>
     /*implicit*/ constexpr ContiguousVectorIterator(
         const ContiguousVectorIterator<OtherIsConst, Options, Parameter...>& other) noexcept
@@ -0,0 +1,259 @@
+// Copyright (c) 2021 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef CNTGS_CNTGS_MAPPEDVECTOR_HPP
+#define CNTGS_CNTGS_MAPPEDVECTOR_HPP
+
+#if __has_include(<sys/mman.h>) && __has_include(<unistd.h>)
+
+#include "cntgs/detail/fileFormat.hpp"
+#include "cntgs/detail/optionsParser.hpp"
+#include "cntgs/serialize.hpp"
+#include "cntgs/vector.hpp"
+#include "cntgs/vectorView.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <ostream>
+#include <streambuf>
+#include <utility>
+
+namespace cntgs
+{
+namespace detail
+{
+class MemoryOutputBuffer : public std::streambuf
+{
+  public:
+    MemoryOutputBuffer(std::byte* memory, std::size_t size) noexcept
+    {
+        auto* const begin = reinterpret_cast<char*>(memory);
+        this->setp(begin, begin + size);
+    }
+};
+
+/// Creates the shared memory object for [cntgs::write_to_shared_memory]() and writes everything but the header. The
+/// object is zero-filled on creation, so that it is rejected by readers that attach before the header is published.
+///
+/// \returns The writable mapping of the object or a null pointer on failure, in which case the object is removed
+template <class... Option, class... Parameter>
+std::byte* write_elements_to_shared_memory(
+    const cntgs::BasicContiguousVector<cntgs::Options<Option...>, Parameter...>& vector, const char* name,
+    ::mode_t mode)
+{
+    using Format = detail::FileFormat<detail::OptionsParser<Option...>, Parameter...>;
+    const auto header = detail::make_file_header(vector);
+    const auto size = Format::file_size(header);
+    ::shm_unlink(name);
+    const int object = ::shm_open(name, O_CREAT | O_EXCL | O_RDWR | O_CLOEXEC, mode);
+    if (object < 0)
+    {
+        return nullptr;
+    }
+    auto* const mapping = ::ftruncate(object, static_cast<::off_t>(size)) == 0
+                              ? ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, object, 0)
+                              : MAP_FAILED;
+    ::close(object);
+    if (mapping != MAP_FAILED)
+    {
+        auto* const memory = static_cast<std::byte*>(mapping);
+        detail::MemoryOutputBuffer buffer{memory + sizeof(header), size - sizeof(header)};
+        std::ostream stream{&buffer};
+        detail::serialize_elements(vector, header, stream);
+        if (stream)
+        {
+            return memory;
+        }
+        ::munmap(mapping, size);
+    }
+    ::shm_unlink(name);
+    return nullptr;
+}
+
+/// Copies the header into a mapping returned by [cntgs::detail::write_elements_to_shared_memory]() and unmaps it. The
+/// magic is stored last, so that readers never accept a partially written header.
+template <class... Option, class... Parameter>
+void publish_shared_memory(const cntgs::BasicContiguousVector<cntgs::Options<Option...>, Parameter...>& vector,
+                           std::byte* memory) noexcept
+{
+    using Format = detail::FileFormat<detail::OptionsParser<Option...>, Parameter...>;
+    const auto header = detail::make_file_header(vector);
+    static constexpr auto MAGIC_SIZE = sizeof(header.magic);
+    static_assert(offsetof(typename Format::Header, magic) == 0);
+    std::memcpy(memory + MAGIC_SIZE, reinterpret_cast<const std::byte*>(&header) + MAGIC_SIZE,
+                sizeof(header) - MAGIC_SIZE);
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(memory, header.magic.data(), MAGIC_SIZE);
+    ::munmap(memory, Format::file_size(header));
+}
+}  // namespace detail
+
+/// Writes a vector of trivially copyable parameters to a file with [cntgs::serialize]() that can be opened with
+/// [cntgs::MappedContiguousVector]().
+///
+/// \returns Whether the file has been written successfully
+template <class... Option, class... Parameter>
+bool write_to_file(const cntgs::BasicContiguousVector<cntgs::Options<Option...>, Parameter...>& vector,
+                   const char* path)
+{
+    std::ofstream file{path, std::ios::binary | std::ios::trunc};
+    return cntgs::serialize(vector, file) && file.flush();
+}
+
+/// Writes a vector of trivially copyable parameters into a new POSIX shared memory object in the format of
+/// [cntgs::serialize]() that can be attached to with [cntgs::MappedContiguousVector::open_shared_memory](). A previous
+/// object of the same name is unlinked first, processes that are still attached to it keep their view of the old
+/// elements. The header is written after the elements and the index, so that processes attaching while the object is
+/// being written fail to open it rather than observe partially written elements.
+///
+/// \param name Name of the shared memory object, as passed to `shm_open`, e.g. `"/graph"`
+/// \param mode Permissions of the shared memory object
+/// \returns Whether the shared memory object has been written successfully
+template <class... Option, class... Parameter>
+bool write_to_shared_memory(const cntgs::BasicContiguousVector<cntgs::Options<Option...>, Parameter...>& vector,
+                            const char* name, ::mode_t mode = 0600)
+{
+    auto* const memory = detail::write_elements_to_shared_memory(vector, name, mode);
+    if (memory == nullptr)
+    {
+        return false;
+    }
+    detail::publish_shared_memory(vector, memory);
+    return true;
+}
+
+/// Removes the name of a shared memory object written by [cntgs::write_to_shared_memory](). The memory is released
+/// once the last process has detached from it.
+///
+/// \returns Whether the name has been removed
+inline bool remove_shared_memory(const char* name) noexcept { return ::shm_unlink(name) == 0; }
+
+/// Read-only vector whose elements reside in a file written by [cntgs::write_to_file]() or [cntgs::serialize](), or in
+/// a shared memory object written by [cntgs::write_to_shared_memory](), that has been mapped into memory with `mmap`.
+/// Opening the file validates the element index but neither reads nor copies the elements, pages are loaded from
+/// disk on first access and shared with other processes that map the same file. Element access is provided by
+/// [cntgs::BasicContiguousVectorView](). Only available on platforms that provide `<sys/mman.h>`.
+///
+/// \param Vector The [cntgs::BasicContiguousVector]() that the file has been written from
+template <class... Option, class... Parameter>
+class MappedContiguousVector<cntgs::BasicContiguousVector<cntgs::Options<Option...>, Parameter...>>
+    : public cntgs::BasicContiguousVectorView<cntgs::Options<Option...>, Parameter...>
+{
+  private:
+    using Base = cntgs::BasicContiguousVectorView<cntgs::Options<Option...>, Parameter...>;
+    using Format = detail::FileFormat<detail::OptionsParser<Option...>, Parameter...>;
+    using Header = typename Format::Header;
+
+  public:
+    using typename Base::size_type;
+
+    MappedContiguousVector() = default;
+
+    /// Maps the file at `path`. The vector remains closed if the file cannot be mapped, has not been written from a
+    /// `Vector` or its element index is not sorted.
+    explicit MappedContiguousVector(const char* path) noexcept { map(::open(path, O_RDONLY | O_CLOEXEC)); }
+
+    MappedContiguousVector(const MappedContiguousVector&) = delete;
+
+    MappedContiguousVector(MappedContiguousVector&& other) noexcept { swap(*this, other); }
+
+    MappedContiguousVector& operator=(const MappedContiguousVector&) = delete;
+
+    MappedContiguousVector& operator=(MappedContiguousVector&& other) noexcept
+    {
+        MappedContiguousVector{std::move(other)}.swap_with(*this);
+        return *this;
+    }
+
+    ~MappedContiguousVector() noexcept
+    {
+        if (mapping_ != nullptr)
+        {
+            ::munmap(mapping_, mapping_size_);
+        }
+    }
+
+    /// Attaches read-only to a shared memory object written by [cntgs::write_to_shared_memory](). The elements are
+    /// shared with all other attached processes. Since the index stores offsets, every process may map the object at a
+    /// different address.
+    [[nodiscard]] static MappedContiguousVector open_shared_memory(const char* name) noexcept
+    {
+        MappedContiguousVector vector;
+        vector.map(::shm_open(name, O_RDONLY | O_CLOEXEC, 0));
+        return vector;
+    }
+
+    [[nodiscard]] bool is_open() const noexcept { return mapping_ != nullptr; }
+
+    /// Size of the mapped file or shared memory object in bytes
+    [[nodiscard]] size_type memory_consumption() const noexcept { return mapping_size_; }
+
+    friend void swap(MappedContiguousVector& lhs, MappedContiguousVector& rhs) noexcept { lhs.swap_with(rhs); }
+
+  private:
+    void map(int file) noexcept
+    {
+        if (file < 0)
+        {
+            return;
+        }
+        struct ::stat status{};
+        const auto file_size = ::fstat(file, &status) == 0 ? static_cast<size_type>(status.st_size) : size_type{};
+        auto* const mapping =
+            file_size < sizeof(Header) ? MAP_FAILED : ::mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, file, 0);
+        ::close(file);
+        if (mapping == MAP_FAILED)
+        {
+            return;
+        }
+        Header header;
+        std::memcpy(&header, mapping, sizeof(Header));
+        // pairs with the release fence of publish_shared_memory
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (!Format::is_compatible(header) || Format::file_size(header) > file_size)
+        {
+            ::munmap(mapping, file_size);
+            return;
+        }
+        const auto* const bytes = static_cast<const std::byte*>(mapping);
+        const auto* const index = reinterpret_cast<const typename Base::index_type*>(bytes + header.index_offset);
+        if constexpr (Format::HAS_INDEX)
+        {
+            if (!Format::is_valid_index(index, header.element_count, header.storage_size) ||
+                index[header.element_count] != header.storage_size)
+            {
+                ::munmap(mapping, file_size);
+                return;
+            }
+        }
+        mapping_ = mapping;
+        mapping_size_ = file_size;
+        static_cast<Base&>(*this) =
+            Base{bytes + header.storage_offset, index, header.element_count, header.fixed_sizes};
+    }
+
+    void swap_with(MappedContiguousVector& other) noexcept
+    {
+        using std::swap;
+        swap(static_cast<Base&>(*this), static_cast<Base&>(other));
+        swap(mapping_, other.mapping_);
+        swap(mapping_size_, other.mapping_size_);
+    }
+
+    void* mapping_{};
+    size_type mapping_size_{};
+};
+}  // namespace cntgs
+
+#endif
+
+#endif  // CNTGS_CNTGS_MAPPEDVECTOR_HPP
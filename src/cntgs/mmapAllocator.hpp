@@ -0,0 +1,196 @@
+// Copyright (c) 2021 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef CNTGS_CNTGS_MMAPALLOCATOR_HPP
+#define CNTGS_CNTGS_MMAPALLOCATOR_HPP
+
+#if __has_include(<sys/mman.h>)
+
+#include <sys/mman.h>
+
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace cntgs
+{
+/// How [cntgs::MmapAllocator]() requests huge pages from the operating system.
+enum class HugePages
+{
+    /// Regular pages only
+    NONE,
+    /// Transparent huge pages through `madvise(MADV_HUGEPAGE)`
+    TRANSPARENT,
+    /// Pages from the explicit huge page pool through `MAP_HUGETLB`, falling back to transparent huge pages when the
+    /// pool is exhausted or unconfigured
+    EXPLICIT
+};
+
+namespace detail
+{
+inline constexpr std::size_t MMAP_HUGE_PAGE_SIZE = std::size_t{2} << 20;
+inline constexpr std::size_t MMAP_THRESHOLD = std::size_t{1} << 20;
+
+constexpr std::size_t mmap_size(std::size_t size_in_bytes) noexcept
+{
+    return (size_in_bytes + MMAP_HUGE_PAGE_SIZE - 1) / MMAP_HUGE_PAGE_SIZE * MMAP_HUGE_PAGE_SIZE;
+}
+
+template <cntgs::HugePages Policy>
+void mmap_advise([[maybe_unused]] void* memory, [[maybe_unused]] std::size_t size) noexcept
+{
+#ifdef MADV_HUGEPAGE
+    if constexpr (Policy != cntgs::HugePages::NONE)
+    {
+        ::madvise(memory, size, MADV_HUGEPAGE);
+    }
+#endif
+}
+
+template <cntgs::HugePages Policy>
+void* mmap_anonymous(std::size_t size) noexcept
+{
+    static constexpr auto PROTECTION = PROT_READ | PROT_WRITE;
+    static constexpr auto FLAGS = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef MAP_HUGETLB
+    if constexpr (Policy == cntgs::HugePages::EXPLICIT)
+    {
+        if (auto* const memory = ::mmap(nullptr, size, PROTECTION, FLAGS | MAP_HUGETLB, -1, 0); memory != MAP_FAILED)
+        {
+            return memory;
+        }
+    }
+#endif
+    auto* const memory = ::mmap(nullptr, size, PROTECTION, FLAGS, -1, 0);
+    if (memory == MAP_FAILED)
+    {
+        return nullptr;
+    }
+    detail::mmap_advise<Policy>(memory, size);
+    return memory;
+}
+
+template <cntgs::HugePages Policy>
+void* mremap_anonymous([[maybe_unused]] void* memory, [[maybe_unused]] std::size_t old_size,
+                       [[maybe_unused]] std::size_t new_size) noexcept
+{
+#ifdef MREMAP_MAYMOVE
+    auto* const new_memory = ::mremap(memory, old_size, new_size, MREMAP_MAYMOVE);
+    if (new_memory == MAP_FAILED)
+    {
+        return nullptr;
+    }
+    detail::mmap_advise<Policy>(new_memory, new_size);
+    return new_memory;
+#else
+    return nullptr;
+#endif
+}
+
+[[noreturn]] inline void throw_bad_alloc()
+{
+#ifdef __cpp_exceptions
+    throw std::bad_alloc{};
+#else
+    std::abort();
+#endif
+}
+}  // namespace detail
+
+/// Allocator that maps large blocks of memory directly from the operating system with `mmap`, optionally backed by huge
+/// pages to reduce TLB misses during random access into large vectors. Allocations are rounded up to a multiple of the
+/// huge page size and are therefore page-aligned, which satisfies the alignment of any
+/// [cntgs::BasicContiguousVector](). Allocations smaller than one MiB, like the element index of small vectors, are
+/// served by `std::allocator`. Only available on platforms that provide `<sys/mman.h>`.
+///
+/// \param T Value type
+/// \param Policy Whether and how huge pages are requested
+template <class T, cntgs::HugePages Policy = cntgs::HugePages::TRANSPARENT>
+class MmapAllocator
+{
+  public:
+    static_assert(alignof(T) <= 4096, "MmapAllocator cannot align beyond the page size");
+
+    using value_type = T;
+    using is_always_equal = std::true_type;
+
+    template <class U>
+    struct rebind
+    {
+        using other = cntgs::MmapAllocator<U, Policy>;
+    };
+
+    MmapAllocator() = default;
+
+    template <class U>
+    constexpr MmapAllocator(const cntgs::MmapAllocator<U, Policy>&) noexcept
+    {
+    }
+
+    [[nodiscard]] T* allocate(std::size_t n)
+    {
+        const auto size_in_bytes = n * sizeof(T);
+        if (size_in_bytes < detail::MMAP_THRESHOLD)
+        {
+            return std::allocator<T>{}.allocate(n);
+        }
+        auto* const memory = detail::mmap_anonymous<Policy>(detail::mmap_size(size_in_bytes));
+        if (memory == nullptr)
+        {
+            detail::throw_bad_alloc();
+        }
+        return static_cast<T*>(memory);
+    }
+
+    /// Resizes an allocation by remapping its pages with `mremap` instead of copying its contents. Returns a null
+    /// pointer if either size is served by `std::allocator` or the platform lacks `mremap`, the original allocation
+    /// then remains valid.
+    [[nodiscard]] T* reallocate(T* pointer, std::size_t old_n, std::size_t new_n) noexcept
+    {
+        const auto old_size_in_bytes = old_n * sizeof(T);
+        const auto new_size_in_bytes = new_n * sizeof(T);
+        if (old_size_in_bytes < detail::MMAP_THRESHOLD || new_size_in_bytes < detail::MMAP_THRESHOLD)
+        {
+            return nullptr;
+        }
+        const auto old_size = detail::mmap_size(old_size_in_bytes);
+        const auto new_size = detail::mmap_size(new_size_in_bytes);
+        if (old_size == new_size)
+        {
+            return pointer;
+        }
+        return static_cast<T*>(detail::mremap_anonymous<Policy>(pointer, old_size, new_size));
+    }
+
+    void deallocate(T* pointer, std::size_t n) noexcept
+    {
+        const auto size_in_bytes = n * sizeof(T);
+        if (size_in_bytes < detail::MMAP_THRESHOLD)
+        {
+            std::allocator<T>{}.deallocate(pointer, n);
+            return;
+        }
+        ::munmap(pointer, detail::mmap_size(size_in_bytes));
+    }
+
+    template <class U>
+    friend constexpr bool operator==(const MmapAllocator&, const cntgs::MmapAllocator<U, Policy>&) noexcept
+    {
+        return true;
+    }
+
+    template <class U>
+    friend constexpr bool operator!=(const MmapAllocator&, const cntgs::MmapAllocator<U, Policy>&) noexcept
+    {
+        return false;
+    }
+};
+}  // namespace cntgs
+
+#endif
+
+#endif  // CNTGS_CNTGS_MMAPALLOCATOR_HPP
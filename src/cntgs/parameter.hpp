@@ -49,6 +49,69 @@ template <class T>
 struct Allocator
 {
 };
+
+/// Enables automatic growth of [cntgs::BasicContiguousVector]() during `emplace_back` and `emplace`. When the capacity
+/// is exhausted the vector grows to `Numerator / Denominator` times its current capacity. For vectors with
+/// [cntgs::VaryingSize]() parameters the memory reserved for varying sized objects grows by the same factor.
+///
+/// \param Numerator Numerator of the growth factor
+/// \param Denominator Denominator of the growth factor, `Numerator / Denominator` must be greater than one
+template <std::size_t Numerator, std::size_t Denominator>
+struct GrowthFactor
+{
+};
+
+/// Unsigned integral type that [cntgs::BasicContiguousVector]() uses to store the offset of each element when it has
+/// [cntgs::VaryingSize]() parameters. Defaults to `std::size_t`. Narrower types reduce the memory consumed by the index
+/// but limit the size of the element storage to the largest value representable by `T`. Constructing, growing or
+/// reserving storage beyond that limit throws `std::length_error`, as does
+/// [cntgs::BasicContiguousFileWriter::emplace_back]() when the file would exceed it, or calls `std::abort` if
+/// exceptions are disabled. [cntgs::deserialize]() rejects such files.
+///
+/// \param T Unsigned integral type, e.g. `std::uint32_t`
+template <class T>
+struct IndexType
+{
+};
+
+/// Removes the per-element index of [cntgs::BasicContiguousVector]() with [cntgs::VaryingSize]() parameters. Elements
+/// can then only be appended and visited sequentially through forward iterators that locate the next element from the
+/// sizes stored in the current one. Random access through `operator[]`, `front`, `back`, `pop_back`, `erase` and
+/// `emplace` is unavailable.
+struct ScanOnly
+{
+};
+
+/// Stores the offset of only every `Stride`-th element of [cntgs::BasicContiguousVector]() with [cntgs::VaryingSize]()
+/// parameters. Elements in between are located by walking forward from the closest stored offset using the sizes
+/// stored in each element, trading lookup latency for an index that is `Stride` times smaller.
+///
+/// \param Stride Number of elements per stored offset, one corresponds to the default dense index
+template <std::size_t Stride>
+struct SampledIndex
+{
+};
+
+/// Places the index of [cntgs::BasicContiguousVector]() with [cntgs::VaryingSize]() parameters at the end of the
+/// element storage instead of in a separate allocation. Every allocation, copy and move of the vector then involves a
+/// single block of memory. Has no effect in combination with [cntgs::ScanOnly]().
+struct CoLocatedIndex
+{
+};
+
+/// How long data prefetched by [cntgs::BasicContiguousVector::prefetch]() is expected to remain useful, mapped to the
+/// temporal locality hint of the prefetch instruction.
+enum class PrefetchLocality
+{
+    /// Accessed once, avoid polluting the caches
+    NONE,
+    /// Kept in the last level cache only
+    LOW,
+    /// Kept in the second level cache and beyond
+    MODERATE,
+    /// Kept in all levels of the cache
+    HIGH
+};
 }  // namespace cntgs
 
 #endif  // CNTGS_CNTGS_PARAMETER_HPP
@@ -230,6 +230,15 @@ class BasicContiguousReference
     template <bool, class, class...>
     friend class ContiguousVectorIterator;
 
+    template <bool, class, class...>
+    friend class ContiguousVectorScanIterator;
+
+    template <bool, class, class...>
+    friend class ContiguousVectorSampledIterator;
+
+    template <class, class...>
+    friend class BasicContiguousVectorView;
+
     constexpr explicit BasicContiguousReference(std::byte* CNTGS_RESTRICT address,
                                                 const typename ListTraits::FixedSizesArray& fixed_sizes = {}) noexcept
         : BasicContiguousReference(ElementTraits::load_element_at(address, fixed_sizes))
@@ -0,0 +1,165 @@
+// Copyright (c) 2021 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef CNTGS_CNTGS_SAMPLEDITERATOR_HPP
+#define CNTGS_CNTGS_SAMPLEDITERATOR_HPP
+
+#include "cntgs/detail/elementLocator.hpp"
+#include "cntgs/detail/forward.hpp"
+#include "cntgs/detail/iterator.hpp"
+#include "cntgs/detail/typeTraits.hpp"
+
+#include <iterator>
+
+namespace cntgs
+{
+/// Random access iterator of a [cntgs::BasicContiguousVector]() with the [cntgs::SampledIndex]() option. It holds the
+/// address of the current element, so that advancing by one computes the address of the next element from the sizes
+/// stored in the current one instead of walking forward from the preceding sample.
+template <bool IsConst, class Options, class... Parameter>
+class ContiguousVectorSampledIterator
+{
+  private:
+    using Vector = cntgs::BasicContiguousVector<Options, Parameter...>;
+    using Locator = typename Vector::ElementLocator::IteratorLocator;
+    using SizeType = typename Vector::size_type;
+
+  public:
+    using value_type = typename Vector::value_type;
+    using reference = detail::ConditionalT<IsConst, typename Vector::const_reference, typename Vector::reference>;
+    using pointer = detail::ArrowProxy<reference>;
+    using difference_type = typename Vector::difference_type;
+    using iterator_category = std::random_access_iterator_tag;
+
+    ContiguousVectorSampledIterator() = default;
+
+    ContiguousVectorSampledIterator(const Vector& vector, SizeType index) noexcept
+        : i_(index), memory_(vector.memory_begin()), locator_(*const_cast<Vector&>(vector).locator_)
+    {
+        address_ = locator_.element_address(i_, memory_);
+    }
+
+    explicit ContiguousVectorSampledIterator(const Vector& vector) noexcept
+        : ContiguousVectorSampledIterator(vector, SizeType{})
+    {
+    }
+
+    template <bool OtherIsConst>
+    /*implicit*/ constexpr ContiguousVectorSampledIterator(
+        const ContiguousVectorSampledIterator<OtherIsConst, Options, Parameter...>& other) noexcept
+        : i_(other.i_), address_(other.address_), memory_(other.memory_), locator_(other.locator_)
+    {
+    }
+
+    [[nodiscard]] constexpr auto index() const noexcept { return i_; }
+
+    [[nodiscard]] constexpr auto data() const noexcept -> detail::ConditionalT<IsConst, const std::byte*, std::byte*>
+    {
+        return address_;
+    }
+
+    [[nodiscard]] reference operator*() const noexcept { return reference{address_, locator_.fixed_sizes()}; }
+
+    [[nodiscard]] pointer operator->() const noexcept { return {*(*this)}; }
+
+    ContiguousVectorSampledIterator& operator++() noexcept
+    {
+        ++i_;
+        address_ = locator_.next_element_address(i_, address_);
+        return *this;
+    }
+
+    ContiguousVectorSampledIterator operator++(int) noexcept
+    {
+        auto copy{*this};
+        ++(*this);
+        return copy;
+    }
+
+    ContiguousVectorSampledIterator& operator--() noexcept { return *this -= 1; }
+
+    ContiguousVectorSampledIterator operator--(int) noexcept
+    {
+        auto copy{*this};
+        --(*this);
+        return copy;
+    }
+
+    [[nodiscard]] ContiguousVectorSampledIterator operator+(difference_type diff) const noexcept
+    {
+        auto copy{*this};
+        copy += diff;
+        return copy;
+    }
+
+    [[nodiscard]] constexpr difference_type operator+(ContiguousVectorSampledIterator it) const noexcept
+    {
+        return i_ + it.i_;
+    }
+
+    ContiguousVectorSampledIterator& operator+=(difference_type diff) noexcept
+    {
+        i_ += diff;
+        address_ = locator_.element_address(i_, memory_);
+        return *this;
+    }
+
+    [[nodiscard]] ContiguousVectorSampledIterator operator-(difference_type diff) const noexcept
+    {
+        auto copy{*this};
+        copy -= diff;
+        return copy;
+    }
+
+    [[nodiscard]] constexpr difference_type operator-(ContiguousVectorSampledIterator it) const noexcept
+    {
+        return i_ - it.i_;
+    }
+
+    ContiguousVectorSampledIterator& operator-=(difference_type diff) noexcept { return *this += -diff; }
+
+    [[nodiscard]] reference operator[](difference_type diff) const noexcept { return *(*this + diff); }
+
+    [[nodiscard]] constexpr bool operator==(const ContiguousVectorSampledIterator& other) const noexcept
+    {
+        return i_ == other.i_ && memory_ == other.memory_;
+    }
+
+    [[nodiscard]] constexpr bool operator!=(const ContiguousVectorSampledIterator& other) const noexcept
+    {
+        return !(*this == other);
+    }
+
+    [[nodiscard]] constexpr bool operator<(const ContiguousVectorSampledIterator& other) const noexcept
+    {
+        return i_ < other.i_ && memory_ == other.memory_;
+    }
+
+    [[nodiscard]] constexpr bool operator>(const ContiguousVectorSampledIterator& other) const noexcept
+    {
+        return other < *this;
+    }
+
+    [[nodiscard]] constexpr bool operator<=(const ContiguousVectorSampledIterator& other) const noexcept
+    {
+        return !(*this > other);
+    }
+
+    [[nodiscard]] constexpr bool operator>=(const ContiguousVectorSampledIterator& other) const noexcept
+    {
+        return !(*this < other);
+    }
+
+  private:
+    friend cntgs::ContiguousVectorSampledIterator<!IsConst, Options, Parameter...>;
+
+    SizeType i_{};
+    std::byte* address_{};
+    std::byte* memory_{};
+    Locator locator_;
+};
+}  // namespace cntgs
+
+#endif  // CNTGS_CNTGS_SAMPLEDITERATOR_HPP
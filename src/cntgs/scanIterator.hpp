@@ -0,0 +1,107 @@
+// Copyright (c) 2021 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef CNTGS_CNTGS_SCANITERATOR_HPP
+#define CNTGS_CNTGS_SCANITERATOR_HPP
+
+#include "cntgs/detail/elementLocator.hpp"
+#include "cntgs/detail/elementTraits.hpp"
+#include "cntgs/detail/forward.hpp"
+#include "cntgs/detail/iterator.hpp"
+#include "cntgs/detail/parameterListTraits.hpp"
+#include "cntgs/detail/typeTraits.hpp"
+#include "cntgs/detail/utility.hpp"
+
+#include <iterator>
+
+namespace cntgs
+{
+/// Forward iterator of a [cntgs::BasicContiguousVector]() with the [cntgs::ScanOnly]() option. Advancing computes the
+/// address of the next element from the sizes stored in the current one.
+template <bool IsConst, class Options, class... Parameter>
+class ContiguousVectorScanIterator
+    : private detail::EmptyBaseOptimization<typename detail::ParameterListTraits<Parameter...>::FixedSizesArray>
+{
+  private:
+    using Vector = cntgs::BasicContiguousVector<Options, Parameter...>;
+    using FixedSizesArray = typename detail::ParameterListTraits<Parameter...>::FixedSizesArray;
+    using Base = detail::EmptyBaseOptimization<FixedSizesArray>;
+    using Locator = detail::ScanElementLocator<Parameter...>;
+    using SizeType = typename Vector::size_type;
+
+  public:
+    using value_type = typename Vector::value_type;
+    using reference = detail::ConditionalT<IsConst, typename Vector::const_reference, typename Vector::reference>;
+    using pointer = detail::ArrowProxy<reference>;
+    using difference_type = typename Vector::difference_type;
+    using iterator_category = std::forward_iterator_tag;
+
+    ContiguousVectorScanIterator() = default;
+
+    constexpr ContiguousVectorScanIterator(const Vector& vector, SizeType index) noexcept
+        : Base{vector.locator_.fixed_sizes()},
+          i_(index),
+          address_(vector.locator_->element_address(index, vector.memory_begin()))
+    {
+    }
+
+    constexpr explicit ContiguousVectorScanIterator(const Vector& vector) noexcept
+        : ContiguousVectorScanIterator(vector, SizeType{})
+    {
+    }
+
+    template <bool OtherIsConst>
+    /*implicit*/ constexpr ContiguousVectorScanIterator(
+        const ContiguousVectorScanIterator<OtherIsConst, Options, Parameter...>& other) noexcept
+        : Base{other.fixed_sizes()}, i_(other.i_), address_(other.address_)
+    {
+    }
+
+    [[nodiscard]] constexpr auto index() const noexcept { return i_; }
+
+    [[nodiscard]] constexpr auto data() const noexcept -> detail::ConditionalT<IsConst, const std::byte*, std::byte*>
+    {
+        return address_;
+    }
+
+    [[nodiscard]] constexpr reference operator*() const noexcept { return reference{address_, fixed_sizes()}; }
+
+    [[nodiscard]] constexpr pointer operator->() const noexcept { return {*(*this)}; }
+
+    constexpr ContiguousVectorScanIterator& operator++() noexcept
+    {
+        address_ = Locator::next_element_address(address_, fixed_sizes());
+        ++i_;
+        return *this;
+    }
+
+    constexpr ContiguousVectorScanIterator operator++(int) noexcept
+    {
+        auto copy{*this};
+        ++(*this);
+        return copy;
+    }
+
+    [[nodiscard]] constexpr bool operator==(const ContiguousVectorScanIterator& other) const noexcept
+    {
+        return i_ == other.i_ && address_ == other.address_;
+    }
+
+    [[nodiscard]] constexpr bool operator!=(const ContiguousVectorScanIterator& other) const noexcept
+    {
+        return !(*this == other);
+    }
+
+  private:
+    friend cntgs::ContiguousVectorScanIterator<!IsConst, Options, Parameter...>;
+
+    constexpr const FixedSizesArray& fixed_sizes() const noexcept { return Base::get(); }
+
+    SizeType i_{};
+    std::byte* address_{};
+};
+}  // namespace cntgs
+
+#endif  // CNTGS_CNTGS_SCANITERATOR_HPP
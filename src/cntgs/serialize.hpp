@@ -0,0 +1,190 @@
+// Copyright (c) 2021 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef CNTGS_CNTGS_SERIALIZE_HPP
+#define CNTGS_CNTGS_SERIALIZE_HPP
+
+#include "cntgs/detail/array.hpp"
+#include "cntgs/detail/elementLocator.hpp"
+#include "cntgs/detail/fileFormat.hpp"
+#include "cntgs/detail/optionsParser.hpp"
+#include "cntgs/vector.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <istream>
+#include <ostream>
+#include <utility>
+
+namespace cntgs
+{
+namespace detail
+{
+inline void write_padding(std::ostream& stream, std::size_t size)
+{
+    static constexpr std::array<char, 64> ZEROS{};
+    while (size > 0)
+    {
+        const auto count = (std::min)(size, ZEROS.size());
+        stream.write(ZEROS.data(), static_cast<std::streamsize>(count));
+        size -= count;
+    }
+}
+
+inline bool read_bytes(std::istream& stream, void* data, std::size_t size)
+{
+    return static_cast<bool>(stream.read(static_cast<char*>(data), static_cast<std::streamsize>(size)));
+}
+
+inline bool skip_bytes(std::istream& stream, std::size_t size)
+{
+    return static_cast<bool>(stream.ignore(static_cast<std::streamsize>(size)));
+}
+
+template <class... Option, class... Parameter>
+auto make_file_header(const cntgs::BasicContiguousVector<cntgs::Options<Option...>, Parameter...>& vector) noexcept
+{
+    using Format = detail::FileFormat<detail::OptionsParser<Option...>, Parameter...>;
+    std::byte* const memory_begin = vector.memory_.get();
+    const auto storage_size = static_cast<std::size_t>(vector.locator_->data_end(memory_begin) - memory_begin);
+    return Format::make_header(vector.size(), storage_size, vector.locator_.fixed_sizes());
+}
+
+/// Writes everything that follows the header of [cntgs::serialize]()
+template <class... Option, class... Parameter, class Header>
+void serialize_elements(const cntgs::BasicContiguousVector<cntgs::Options<Option...>, Parameter...>& vector,
+                        const Header& header, std::ostream& stream)
+{
+    using Format = detail::FileFormat<detail::OptionsParser<Option...>, Parameter...>;
+    using IndexType = typename Format::IndexType;
+    std::byte* const memory_begin = vector.memory_.get();
+    const auto storage_size = header.storage_size;
+    assert(memory_begin == nullptr || static_cast<std::size_t>(memory_begin - vector.allocation_begin()) ==
+                                          header.storage_offset % Format::STORAGE_ALIGNMENT);
+    detail::write_padding(stream, header.storage_offset - sizeof(header));
+    stream.write(reinterpret_cast<const char*>(memory_begin), static_cast<std::streamsize>(storage_size));
+    if constexpr (Format::HAS_INDEX)
+    {
+        const auto end_offset = detail::to_element_offset<IndexType>(storage_size);
+        detail::write_padding(stream, header.index_offset - header.storage_offset - storage_size);
+        stream.write(reinterpret_cast<const char*>(vector.locator_->index_data()),
+                     static_cast<std::streamsize>(header.element_count * sizeof(IndexType)));
+        stream.write(reinterpret_cast<const char*>(&end_offset), sizeof(end_offset));
+    }
+}
+
+template <class Vector, class Format>
+Vector construct_for_deserialization(const typename Format::Header& header,
+                                     const typename Vector::allocator_type& allocator)
+{
+    using ListTraits = typename Format::ListTraits;
+    using ElementTraits = typename Format::ElementTraits;
+    const auto element_count = header.element_count;
+    if constexpr (Format::HAS_INDEX)
+    {
+        const auto element_size = ElementTraits::calculate_element_size(header.fixed_sizes);
+        const auto memory_size_without_varying_size =
+            ElementTraits::calculate_needed_memory_size(element_count, {}, element_size) -
+            element_size.distance_to_first;
+        const auto varying_size_bytes = header.storage_size > memory_size_without_varying_size
+                                            ? header.storage_size - memory_size_without_varying_size
+                                            : std::size_t{};
+        if constexpr (ListTraits::IS_MIXED)
+        {
+            return Vector{element_count, varying_size_bytes, detail::to_std_array(header.fixed_sizes), allocator};
+        }
+        else
+        {
+            return Vector{element_count, varying_size_bytes, allocator};
+        }
+    }
+    else if constexpr (ListTraits::IS_ALL_FIXED_SIZE)
+    {
+        return Vector{element_count, detail::to_std_array(header.fixed_sizes), allocator};
+    }
+    else
+    {
+        return Vector{element_count, allocator};
+    }
+}
+}  // namespace detail
+
+/// Writes a vector of trivially copyable parameters to `stream` in a binary format that can be read with
+/// [cntgs::deserialize]() and mapped with [cntgs::MappedContiguousVector](). A header that carries a fingerprint of the
+/// parameter list, the alignment of the element storage, the fixed sizes, the element count and the number of bytes
+/// occupied by the elements precedes the element storage and, for vectors with [cntgs::VaryingSize]() parameters, the
+/// element index. The format is specific to the endianness and type sizes of the writing platform. Vectors with the
+/// [cntgs::ScanOnly]() or [cntgs::SampledIndex]() option are not supported.
+///
+/// \returns Whether `stream` is still good after writing
+template <class... Option, class... Parameter>
+bool serialize(const cntgs::BasicContiguousVector<cntgs::Options<Option...>, Parameter...>& vector,
+               std::ostream& stream)
+{
+    const auto header = detail::make_file_header(vector);
+    stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    detail::serialize_elements(vector, header, stream);
+    return static_cast<bool>(stream);
+}
+
+/// Reads a vector written by [cntgs::serialize]() from `stream` and assigns it to `vector`. The header is validated
+/// first, so that a stream written from a vector with different parameters is rejected without reading any further.
+/// The element storage and the element index are then each read with a single call to `std::istream::read`. The
+/// resulting vector has a capacity equal to its size and uses the allocator of `vector`. A stream whose element storage
+/// exceeds the range of the [cntgs::IndexType]() option, whose element count does not fit into its element storage or
+/// whose element index is not sorted is rejected.
+///
+/// \returns Whether the vector has been read successfully, `vector` is left unchanged otherwise
+template <class... Option, class... Parameter>
+bool deserialize(std::istream& stream, cntgs::BasicContiguousVector<cntgs::Options<Option...>, Parameter...>& vector)
+{
+    using Vector = cntgs::BasicContiguousVector<cntgs::Options<Option...>, Parameter...>;
+    using Format = detail::FileFormat<detail::OptionsParser<Option...>, Parameter...>;
+    using IndexType = typename Format::IndexType;
+    typename Format::Header header;
+    if (!detail::read_bytes(stream, &header, sizeof(header)) || !Format::is_compatible(header))
+    {
+        return false;
+    }
+    if constexpr (Format::HAS_INDEX)
+    {
+        if (!detail::is_within_index_range<IndexType>(header.storage_size))
+        {
+            return false;
+        }
+    }
+    auto result = detail::construct_for_deserialization<Vector, Format>(header, vector.get_allocator());
+    std::byte* const memory_begin = result.memory_.get();
+    assert(header.storage_size <=
+           static_cast<std::size_t>(result.allocation_begin() + result.memory_consumption() - memory_begin));
+    if (!detail::skip_bytes(stream, header.storage_offset - sizeof(header)) ||
+        !detail::read_bytes(stream, memory_begin, header.storage_size))
+    {
+        return false;
+    }
+    if constexpr (Format::HAS_INDEX)
+    {
+        IndexType end_offset;
+        if (!detail::skip_bytes(stream, header.index_offset - header.storage_offset - header.storage_size) ||
+            !detail::read_bytes(stream, result.locator_->index_data(), header.element_count * sizeof(IndexType)) ||
+            !detail::read_bytes(stream, &end_offset, sizeof(end_offset)) || end_offset != header.storage_size ||
+            !Format::is_valid_index(result.locator_->index_data(), header.element_count, header.storage_size))
+        {
+            return false;
+        }
+        result.locator_->assign_index(header.element_count, memory_begin + end_offset);
+    }
+    else
+    {
+        result.locator_->resize(header.element_count, memory_begin);
+    }
+    vector = std::move(result);
+    return true;
+}
+}  // namespace cntgs
+
+#endif  // CNTGS_CNTGS_SERIALIZE_HPP
@@ -0,0 +1,35 @@
+// Copyright (c) 2021 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef CNTGS_CNTGS_TYPETRAITS_HPP
+#define CNTGS_CNTGS_TYPETRAITS_HPP
+
+#include <memory>
+#include <type_traits>
+
+namespace cntgs
+{
+/// Customization point that declares objects of type `T` to be trivially relocatable: Moving an object to a new address
+/// and ending the lifetime of the original is equivalent to copying its bytes. [cntgs::BasicContiguousVector]()
+/// relocates elements whose parameters are all trivially relocatable with `std::memcpy`/`std::memmove` when growing,
+/// erasing and emplacing. Specialize this template and derive from `std::true_type` to opt-in user-defined types.
+///
+/// \param T User-defined or built-in type
+template <class T>
+struct is_trivially_relocatable
+    : std::bool_constant<std::is_trivially_move_constructible_v<T> && std::is_trivially_destructible_v<T>>
+{
+};
+
+template <class T, class Deleter>
+struct is_trivially_relocatable<std::unique_ptr<T, Deleter>> : cntgs::is_trivially_relocatable<Deleter>
+{
+};
+
+template <class T>
+inline constexpr bool is_trivially_relocatable_v = cntgs::is_trivially_relocatable<T>::value;
+}  // namespace cntgs
+
+#endif  // CNTGS_CNTGS_TYPETRAITS_HPP
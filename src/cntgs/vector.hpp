@@ -16,18 +16,27 @@
 #include "cntgs/detail/parameterListTraits.hpp"
 #include "cntgs/detail/parameterTraits.hpp"
 #include "cntgs/detail/storage.hpp"
+#include "cntgs/detail/typeTraits.hpp"
 #include "cntgs/detail/utility.hpp"
 #include "cntgs/detail/vectorTraits.hpp"
 #include "cntgs/element.hpp"
 #include "cntgs/iterator.hpp"
 #include "cntgs/parameter.hpp"
 #include "cntgs/reference.hpp"
+#include "cntgs/sampledIterator.hpp"
+#include "cntgs/scanIterator.hpp"
 #include "cntgs/span.hpp"
 
 #include <algorithm>
+#include <cassert>
 #include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace cntgs
 {
@@ -37,9 +46,18 @@ template <class... Parameter>
 using ContiguousVector = cntgs::BasicContiguousVector<cntgs::Options<>, Parameter...>;
 // end-snippet
 
+template <class... Option, class... Parameter, class Predicate>
+std::size_t erase_if(cntgs::BasicContiguousVector<cntgs::Options<Option...>, Parameter...>& vector,
+                     Predicate predicate);
+
+template <class... Option, class... Parameter, class Projection, class Compare = std::less<>>
+void sort(cntgs::BasicContiguousVector<cntgs::Options<Option...>, Parameter...>& vector, Projection projection,
+          Compare compare = {});
+
 /// Container that stores the value of each specified parameter contiguously.
 ///
-/// \param Option Any of [cntgs::Allocator]() wrapped into [cntgs::Options]().
+/// \param Option Any of [cntgs::Allocator](), [cntgs::GrowthFactor](), [cntgs::IndexType](), [cntgs::ScanOnly](),
+/// [cntgs::SampledIndex]() or [cntgs::CoLocatedIndex]() wrapped into [cntgs::Options]().
 /// \param Parameter Any of [cntgs::VaryingSize](), [cntgs::FixedSize](), [cntgs::AlignAs]() or a plain user-defined or
 /// built-in type. The underlying type of each parameter must satisfy
 /// [Erasable](https://en.cppreference.com/w/cpp/named_req/Erasable).
@@ -55,8 +73,9 @@ class BasicContiguousVector<cntgs::Options<Option...>, Parameter...>
     using StorageElementType = typename ElementTraits::StorageElementType;
     using Allocator =
         typename std::allocator_traits<typename ParsedOptions::Allocator>::template rebind_alloc<StorageElementType>;
-    using ElementLocator = detail::ElementLocatorT<Parameter...>;
-    using ElementLocatorAndFixedSizes = detail::ElementLocatorAndFixedSizes<Parameter...>;
+    using IndexType = typename ParsedOptions::IndexType;
+    using ElementLocator = detail::ElementLocatorT<ParsedOptions, Parameter...>;
+    using ElementLocatorAndFixedSizes = detail::ElementLocatorAndFixedSizes<ElementLocator, Parameter...>;
     using AllocatorTraits = std::allocator_traits<Allocator>;
     using StorageType = detail::Storage<ElementTraits::FIRST_ELEMENT_HAS_OFFSET, Allocator>;
     using FixedSizes = typename ListTraits::FixedSizes;
@@ -64,11 +83,21 @@ class BasicContiguousVector<cntgs::Options<Option...>, Parameter...>
 
     static_assert(ListTraits::template ParameterTraitsAt<0>::TYPE != detail::ParameterType::VARYING_SIZE,
                   "VaryingSize must be preceded by a parameter that represents its size");
+    static_assert(!ParsedOptions::ScanOnly::value || !ParsedOptions::SampledIndex::value,
+                  "ScanOnly and SampledIndex are mutually exclusive");
 
     static constexpr bool IS_MIXED = ListTraits::IS_MIXED;
     static constexpr bool IS_ALL_FIXED_SIZE = ListTraits::IS_ALL_FIXED_SIZE;
     static constexpr bool IS_ALL_VARYING_SIZE = ListTraits::IS_ALL_VARYING_SIZE;
     static constexpr bool IS_ALL_PLAIN = ListTraits::IS_ALL_PLAIN;
+    static constexpr bool HAS_VARYING_SIZE = !ListTraits::IS_FIXED_SIZE_OR_PLAIN;
+    static constexpr bool IS_SCAN_ONLY = HAS_VARYING_SIZE && ParsedOptions::ScanOnly::value;
+    static constexpr bool IS_SAMPLED_INDEX = HAS_VARYING_SIZE && ParsedOptions::SampledIndex::STRIDE > 1;
+    static constexpr bool IS_CO_LOCATED_INDEX =
+        HAS_VARYING_SIZE && !IS_SCAN_ONLY && ParsedOptions::CoLocatedIndex::value;
+    static constexpr bool IS_AUTO_GROWING = ParsedOptions::GrowthFactor::value;
+    static constexpr bool CAN_REALLOCATE_IN_PLACE =
+        detail::HAS_REALLOCATE<Allocator> && ListTraits::IS_TRIVIALLY_RELOCATABLE;
 
   public:
     /// Type that can create copies of [cntgs::BasicContiguousVector::reference]() and
@@ -82,8 +111,16 @@ class BasicContiguousVector<cntgs::Options<Option...>, Parameter...>
     /// A [cntgs::ContiguousConstReference]()
     /// \exclude target
     using const_reference = typename VectorTraits::ConstReferenceType;
-    using iterator = cntgs::ContiguousVectorIterator<false, cntgs::Options<Option...>, Parameter...>;
-    using const_iterator = cntgs::ContiguousVectorIterator<true, cntgs::Options<Option...>, Parameter...>;
+    using iterator = detail::ConditionalT<
+        IS_SCAN_ONLY, cntgs::ContiguousVectorScanIterator<false, cntgs::Options<Option...>, Parameter...>,
+        detail::ConditionalT<IS_SAMPLED_INDEX,
+                             cntgs::ContiguousVectorSampledIterator<false, cntgs::Options<Option...>, Parameter...>,
+                             cntgs::ContiguousVectorIterator<false, cntgs::Options<Option...>, Parameter...>>>;
+    using const_iterator = detail::ConditionalT<
+        IS_SCAN_ONLY, cntgs::ContiguousVectorScanIterator<true, cntgs::Options<Option...>, Parameter...>,
+        detail::ConditionalT<IS_SAMPLED_INDEX,
+                             cntgs::ContiguousVectorSampledIterator<true, cntgs::Options<Option...>, Parameter...>,
+                             cntgs::ContiguousVectorIterator<true, cntgs::Options<Option...>, Parameter...>>>;
     using difference_type = std::ptrdiff_t;
     using size_type = std::size_t;
     using allocator_type = Allocator;
@@ -154,30 +191,123 @@ class BasicContiguousVector<cntgs::Options<Option...>, Parameter...>
         return *this;
     }
 
-    ~BasicContiguousVector() noexcept { destruct_if_owned(); }
+    ~BasicContiguousVector() noexcept
+    {
+        destruct_if_owned();
+        deallocate_index();
+    }
 
     template <class... Args>
     void emplace_back(Args&&... args)
     {
+        grow_if_needed(args...);
         emplace_back_impl(static_cast<Args&&>(args)...);
     }
 
     template <class... Args>
     iterator emplace(const_iterator position, Args&&... args)
     {
+        static_assert(!IS_SCAN_ONLY, "emplace is not supported by ScanOnly vectors");
+        static_assert(!IS_SAMPLED_INDEX, "emplace is not supported by vectors with a SampledIndex");
+        grow_if_needed(args...);
         auto it = make_iterator(position);
         const auto target_begin = it.data();
-        const auto back_begin = data_end();
+        const auto back_begin = locator_->data_end(memory_begin());
         const auto back_end = emplace_back_impl(static_cast<Args&&>(args)...);
         const auto byte_count = back_end - back_begin;
         make_room_for_last_element_at(it.index(), byte_count);
         std::memcpy(target_begin, back_end, byte_count);
-        auto&& source = (*this)[size()];
-        auto&& target = ElementTraits::load_element_at(target_begin, locator_.fixed_sizes());
-        ElementTraits::template construct_if_non_trivial<true>(source, target);
+        if constexpr (!ListTraits::IS_TRIVIALLY_RELOCATABLE)
+        {
+            auto&& source = (*this)[size()];
+            auto&& target = ElementTraits::load_element_at(target_begin, locator_.fixed_sizes());
+            ElementTraits::template construct_if_non_trivial<true>(source, target);
+        }
         return std::next(begin(), it.index());
     }
 
+    /// Inserts copies of the elements in `[first, last)` before `position`. The size in memory of all new elements is
+    /// computed up front, so that the elements behind `position` are moved only once and the index is updated in a
+    /// single pass.
+    ///
+    /// \param first,last Forward iterators over references or elements of a vector with the same parameters and fixed
+    /// sizes. They must not point into this vector.
+    /// \returns Iterator to the first inserted element
+    template <class Iterator>
+    iterator insert(const_iterator position, Iterator first, Iterator last)
+    {
+        static_assert(!IS_SCAN_ONLY, "insert is not supported by ScanOnly vectors");
+        static_assert(!IS_SAMPLED_INDEX, "insert is not supported by vectors with a SampledIndex");
+        const auto index = position.index();
+        if (first == last)
+        {
+            return std::next(begin(), index);
+        }
+        const auto count = static_cast<size_type>(std::distance(first, last));
+        const auto byte_count = size_in_memory_of(first, last);
+        grow_if_needed_for(count, byte_count + alignof(StorageElementType) - size_type{1});
+        const auto current_size = size();
+        if constexpr (HAS_VARYING_SIZE)
+        {
+            auto* const data_end = locator_->data_end(memory_begin());
+            auto* address = index == current_size ? ElementTraits::align_for_first_parameter(data_end)
+                                                  : locator_->element_address(index, memory_begin());
+            auto* last_element = index == current_size ? data_end : data_end + byte_count;
+            move_elements_back(index, count, byte_count);
+            auto* const offsets = locator_->index_data();
+            for (auto i = current_size; i != index; --i)
+            {
+                offsets[i - 1 + count] = detail::to_element_offset<IndexType>(offsets[i - 1] + byte_count);
+            }
+            for (auto i = index; first != last; ++first, (void)++i)
+            {
+                offsets[i] = detail::to_element_offset<IndexType>(address - memory_begin());
+                auto* const end = emplace_element_at(address, *first, ListTraits::make_index_sequence());
+                address = ElementTraits::align_for_first_parameter(end);
+                if (index == current_size)
+                {
+                    last_element = end;
+                }
+            }
+            assert(index == current_size || address == memory_begin() + offsets[index + count]);
+            locator_->assign_index(current_size + count, last_element);
+        }
+        else
+        {
+            move_elements_back(index, count, byte_count);
+            for (auto i = index; first != last; ++first, (void)++i)
+            {
+                emplace_element_at(locator_->element_address(i, memory_begin()), *first,
+                                   ListTraits::make_index_sequence());
+            }
+            locator_->resize(current_size + count, memory_begin());
+        }
+        return std::next(begin(), index);
+    }
+
+    /// Appends copies of all elements of `range`, growing the memory at most once. Supports all options.
+    ///
+    /// \param range Forward range over references or elements of a vector with the same parameters and fixed sizes. It
+    /// must not refer to this vector.
+    template <class Range>
+    void append_range(const Range& range)
+    {
+        using std::begin;
+        using std::end;
+        const auto first = begin(range);
+        const auto last = end(range);
+        if (first == last)
+        {
+            return;
+        }
+        grow_if_needed_for(static_cast<size_type>(std::distance(first, last)),
+                           size_in_memory_of(first, last) + alignof(StorageElementType) - size_type{1});
+        for (auto it = first; it != last; ++it)
+        {
+            emplace_back_element(*it, ListTraits::make_index_sequence());
+        }
+    }
+
     void pop_back() noexcept
     {
         ElementTraits::destruct(back());
@@ -186,24 +316,97 @@ class BasicContiguousVector<cntgs::Options<Option...>, Parameter...>
 
     void reserve(size_type new_max_element_count, size_type new_varying_size_bytes = {})
     {
-        if (max_element_count_ < new_max_element_count)
+        if constexpr (HAS_VARYING_SIZE)
+        {
+            const auto current_varying_size_bytes = varying_capacity();
+            if (max_element_count_ < new_max_element_count || current_varying_size_bytes < new_varying_size_bytes)
+            {
+                grow((std::max)(max_element_count_, new_max_element_count),
+                     (std::max)(current_varying_size_bytes, new_varying_size_bytes));
+            }
+        }
+        else
+        {
+            if (max_element_count_ < new_max_element_count)
+            {
+                grow(new_max_element_count, new_varying_size_bytes);
+            }
+        }
+    }
+
+    /// Increases the memory reserved for objects of [cntgs::VaryingSize]() parameters to at least
+    /// `new_varying_size_bytes` without changing the [cntgs::BasicContiguousVector::capacity]().
+    template <bool HasVaryingSize = HAS_VARYING_SIZE>
+    auto reserve_bytes(size_type new_varying_size_bytes) -> std::enable_if_t<HasVaryingSize>
+    {
+        if (varying_capacity() < new_varying_size_bytes)
         {
-            grow(new_max_element_count, new_varying_size_bytes);
+            grow(max_element_count_, new_varying_size_bytes);
+        }
+    }
+
+    /// Reallocates the storage to fit exactly [cntgs::BasicContiguousVector::size]() elements and, for vectors with
+    /// [cntgs::VaryingSize]() parameters, exactly [cntgs::BasicContiguousVector::varying_size]() bytes.
+    void shrink_to_fit()
+    {
+        if constexpr (HAS_VARYING_SIZE)
+        {
+            const auto new_varying_size_bytes = varying_size();
+            if (max_element_count_ != size() ||
+                varying_capacity() - new_varying_size_bytes >= alignof(StorageElementType))
+            {
+                grow(size(), new_varying_size_bytes);
+            }
+        }
+        else
+        {
+            if (max_element_count_ != size())
+            {
+                grow(size(), {});
+            }
+        }
+    }
+
+    /// Like [cntgs::BasicContiguousVector::shrink_to_fit]() but additionally places the element index of vectors with
+    /// [cntgs::VaryingSize]() parameters at the end of the element storage so that the entire vector occupies a single
+    /// allocation. Intended for vectors that are only read from afterwards, growing a frozen vector moves the index
+    /// back into a separate allocation.
+    void freeze()
+    {
+        if constexpr (HAS_VARYING_SIZE && !IS_SCAN_ONLY && !IS_CO_LOCATED_INDEX)
+        {
+            if (locator_->is_index_within(allocation_begin(), allocation_begin() + memory_consumption()))
+            {
+                return;
+            }
+            const auto current_size = size();
+            const auto memory_size = used_memory_consumption();
+            auto new_memory = allocate_memory(memory_size + ElementLocator::index_memory_size(current_size),
+                                              memory_.get_offset(), get_allocator());
+            const auto index = ElementLocator::index_begin(new_memory.allocation_begin() + memory_size);
+            ElementLocator other_locator{*locator_, memory_begin(), new_memory.get(), index};
+            reallocate(current_size, new_memory, other_locator);
+        }
+        else
+        {
+            shrink_to_fit();
         }
     }
 
     iterator erase(const_iterator position) noexcept(ListTraits::IS_NOTHROW_MOVE_CONSTRUCTIBLE)
     {
+        static_assert(!IS_SCAN_ONLY, "erase is not supported by ScanOnly vectors");
         auto it_position = make_iterator(position);
         const auto next_position = position.index() + 1;
         ElementTraits::destruct(*it_position);
         move_elements_forward(next_position, it_position.index());
         locator_->resize(size() - size_type{1}, memory_begin());
-        return it_position;
+        return make_iterator(position);
     }
 
     iterator erase(const_iterator first, const_iterator last) noexcept(ListTraits::IS_NOTHROW_MOVE_CONSTRUCTIBLE)
     {
+        static_assert(!IS_SCAN_ONLY, "erase is not supported by ScanOnly vectors");
         const auto current_size = size();
         const auto it_first = make_iterator(first);
         const auto it_last = make_iterator(last);
@@ -213,7 +416,37 @@ class BasicContiguousVector<cntgs::Options<Option...>, Parameter...>
             move_elements_forward(last.index(), first.index());
         }
         locator_->resize(current_size - (last.index() - first.index()), memory_begin());
-        return it_first;
+        return make_iterator(first);
+    }
+
+    /// Erases the element at `position` in constant time by relocating the last element into its place, which does not
+    /// preserve the order of the elements. The last element is copied with a single `memcpy` if all parameters are
+    /// trivially relocatable. Only available for vectors without [cntgs::VaryingSize]() parameters.
+    ///
+    /// \returns Iterator to the element that took the place of the erased one or end() if the last element was erased
+    template <bool HasVaryingSize = HAS_VARYING_SIZE>
+    auto erase_unordered(const_iterator position) noexcept(ListTraits::IS_NOTHROW_MOVE_CONSTRUCTIBLE)
+        -> std::enable_if_t<!HasVaryingSize, iterator>
+    {
+        const auto index = position.index();
+        const auto last = size() - size_type{1};
+        ElementTraits::destruct((*this)[index]);
+        if (index != last)
+        {
+            if constexpr (ListTraits::IS_TRIVIALLY_RELOCATABLE)
+            {
+                auto* const source = locator_->element_address(last, memory_begin());
+                auto* const source_end = ElementTraits::element_end(source, locator_.fixed_sizes());
+                std::memcpy(locator_->element_address(index, memory_begin()), source,
+                            static_cast<size_type>(source_end - source));
+            }
+            else
+            {
+                emplace_at(index, (*this)[last], ListTraits::make_index_sequence());
+            }
+        }
+        locator_->resize(last, memory_begin());
+        return make_iterator(position);
     }
 
     void clear() noexcept
@@ -224,11 +457,13 @@ class BasicContiguousVector<cntgs::Options<Option...>, Parameter...>
 
     [[nodiscard]] reference operator[](size_type i) noexcept
     {
+        static_assert(!IS_SCAN_ONLY, "random access is not supported by ScanOnly vectors");
         return reference{locator_->element_address(i, memory_begin()), locator_.fixed_sizes()};
     }
 
     [[nodiscard]] const_reference operator[](size_type i) const noexcept
     {
+        static_assert(!IS_SCAN_ONLY, "random access is not supported by ScanOnly vectors");
         return const_reference{locator_->element_address(i, memory_begin()), locator_.fixed_sizes()};
     }
 
@@ -240,6 +475,45 @@ class BasicContiguousVector<cntgs::Options<Option...>, Parameter...>
 
     [[nodiscard]] const_reference back() const noexcept { return (*this)[size() - size_type{1}]; }
 
+    /// Hints the processor to load the element at `i` into the cache so that a later access does not stall on memory.
+    /// Without [cntgs::VaryingSize]() parameters all cache lines of the element are prefetched. Otherwise the offset of
+    /// the element is read from the index and the first cache line of the element is prefetched.
+    void prefetch(size_type i, cntgs::PrefetchLocality locality = cntgs::PrefetchLocality::HIGH) const noexcept
+    {
+        static_assert(!IS_SCAN_ONLY, "random access is not supported by ScanOnly vectors");
+        detail::prefetch_element(*locator_, i, memory_begin(), locality);
+    }
+
+    /// Invokes `function` with a reference to the element at each position in `indices`, in order. Intended for bulk
+    /// random lookups: the offset of an element and then the element itself are prefetched several lookups ahead so
+    /// that their cache misses overlap with the processing of the preceding elements.
+    ///
+    /// \param indices Range of positions, each less than `size()`. Positions may repeat.
+    /// \param function Callable with a [cntgs::BasicContiguousVector::reference]()
+    template <class Indices, class Function>
+    void for_each_index(const Indices& indices, Function&& function)
+    {
+        static_assert(!IS_SCAN_ONLY, "random access is not supported by ScanOnly vectors");
+        detail::for_each_index(*locator_, memory_begin(), indices,
+                               [&](std::byte* address)
+                               {
+                                   function(reference{address, locator_.fixed_sizes()});
+                               });
+    }
+
+    /// Same as the non-const overload but invokes `function` with a
+    /// [cntgs::BasicContiguousVector::const_reference]()
+    template <class Indices, class Function>
+    void for_each_index(const Indices& indices, Function&& function) const
+    {
+        static_assert(!IS_SCAN_ONLY, "random access is not supported by ScanOnly vectors");
+        detail::for_each_index(*locator_, memory_begin(), indices,
+                               [&](std::byte* address)
+                               {
+                                   function(const_reference{address, locator_.fixed_sizes()});
+                               });
+    }
+
     template <std::size_t I>
     [[nodiscard]] constexpr size_type get_fixed_size() const noexcept
     {
@@ -270,7 +544,14 @@ class BasicContiguousVector<cntgs::Options<Option...>, Parameter...>
     {
         if (!empty())
         {
-            return back().data_end();
+            if constexpr (IS_SCAN_ONLY)
+            {
+                return locator_->data_end(memory_begin());
+            }
+            else
+            {
+                return back().data_end();
+            }
         }
         return nullptr;
     }
@@ -279,6 +560,27 @@ class BasicContiguousVector<cntgs::Options<Option...>, Parameter...>
 
     [[nodiscard]] constexpr size_type capacity() const noexcept { return max_element_count_; }
 
+    /// Number of bytes reserved for objects of [cntgs::VaryingSize]() parameters, including those already in use.
+    template <bool HasVaryingSize = HAS_VARYING_SIZE>
+    [[nodiscard]] auto varying_capacity() const noexcept -> std::enable_if_t<HasVaryingSize, size_type>
+    {
+        const auto memory_size_without_varying_size = memory_size_for(max_element_count_, {});
+        const auto memory_size = element_memory_consumption();
+        return memory_size > memory_size_without_varying_size ? memory_size - memory_size_without_varying_size
+                                                               : size_type{};
+    }
+
+    /// Number of bytes of [cntgs::BasicContiguousVector::varying_capacity]() that are used by the current elements.
+    template <bool HasVaryingSize = HAS_VARYING_SIZE>
+    [[nodiscard]] auto varying_size() const noexcept -> std::enable_if_t<HasVaryingSize, size_type>
+    {
+        const auto memory_size_without_varying_size = memory_size_for(size(), {});
+        const auto used_memory_size = used_memory_consumption();
+        return used_memory_size > memory_size_without_varying_size
+                   ? used_memory_size - memory_size_without_varying_size
+                   : size_type{};
+    }
+
     [[nodiscard]] constexpr size_type memory_consumption() const noexcept
     {
         return memory_.size() * alignof(StorageElementType);
@@ -359,6 +661,20 @@ class BasicContiguousVector<cntgs::Options<Option...>, Parameter...>
     template <bool, class, class...>
     friend class cntgs::ContiguousVectorIterator;
 
+    template <bool, class, class...>
+    friend class cntgs::ContiguousVectorScanIterator;
+
+    template <bool, class, class...>
+    friend class cntgs::ContiguousVectorSampledIterator;
+
+    template <class... TOption, class... TParameter, class Predicate>
+    friend std::size_t cntgs::erase_if(cntgs::BasicContiguousVector<cntgs::Options<TOption...>, TParameter...>&,
+                                       Predicate);
+
+    template <class... TOption, class... TParameter, class Projection, class Compare>
+    friend void cntgs::sort(cntgs::BasicContiguousVector<cntgs::Options<TOption...>, TParameter...>&, Projection,
+                            Compare);
+
     constexpr BasicContiguousVector(size_type max_element_count, size_type varying_size_bytes,
                                     const FixedSizes& fixed_sizes, const allocator_type& allocator, int)
         : BasicContiguousVector(max_element_count, varying_size_bytes, FixedSizesArray{fixed_sizes}, allocator,
@@ -371,14 +687,26 @@ class BasicContiguousVector<cntgs::Options<Option...>, Parameter...>
                                     detail::ElementSize size)
         : max_element_count_(max_element_count),
           memory_(
-              allocate_memory(ElementTraits::calculate_needed_memory_size(max_element_count, varying_size_bytes, size),
+              allocate_memory(checked_memory_size(ElementTraits::calculate_needed_memory_size(
+                                  max_element_count, varying_size_bytes, size)) +
+                                  co_located_index_memory_size(max_element_count),
                               size.distance_to_first, allocator)),
-          locator_(max_element_count, memory_begin(), fixed_sizes, size, allocator)
+          locator_(construct_locator(max_element_count, fixed_sizes, size, allocator))
     {
     }
 
     [[nodiscard]] std::byte* memory_begin() const noexcept { return memory_.get(); }
 
+    /// Offsets into the element storage must be representable by the [cntgs::IndexType]() option
+    static constexpr size_type checked_memory_size(size_type memory_size)
+    {
+        if constexpr (HAS_VARYING_SIZE && !IS_SCAN_ONLY)
+        {
+            detail::check_index_range<IndexType>(memory_size);
+        }
+        return memory_size;
+    }
+
     static StorageType allocate_memory(size_type size, size_type distance_to_first, const allocator_type& allocator)
     {
         auto storage = ElementTraits::template allocate_memory<StorageType>(size, allocator);
@@ -386,22 +714,246 @@ class BasicContiguousVector<cntgs::Options<Option...>, Parameter...>
         return storage;
     }
 
+    static constexpr size_type co_located_index_memory_size([[maybe_unused]] size_type max_element_count) noexcept
+    {
+        if constexpr (IS_CO_LOCATED_INDEX)
+        {
+            return ElementLocator::index_memory_size(max_element_count);
+        }
+        else
+        {
+            return {};
+        }
+    }
+
+    static IndexType* co_located_index(const StorageType& memory, size_type max_element_count) noexcept
+    {
+        const auto memory_end = memory.allocation_begin() + memory.size() * alignof(StorageElementType);
+        return ElementLocator::index_begin(memory_end - co_located_index_memory_size(max_element_count));
+    }
+
+    ElementLocatorAndFixedSizes construct_locator(size_type max_element_count, const FixedSizesArray& fixed_sizes,
+                                                  detail::ElementSize size, const allocator_type& allocator) const
+    {
+        if constexpr (IS_CO_LOCATED_INDEX)
+        {
+            return {max_element_count, memory_begin(), fixed_sizes, size,
+                    co_located_index(memory_, max_element_count)};
+        }
+        else
+        {
+            return {max_element_count, memory_begin(), fixed_sizes, size, allocator};
+        }
+    }
+
+    ElementLocatorAndFixedSizes copy_locator(const ElementLocatorAndFixedSizes& locator, std::byte* old_memory_begin,
+                                             size_type old_max_element_count, const StorageType& new_memory,
+                                             size_type new_max_element_count) const
+    {
+        if constexpr (IS_CO_LOCATED_INDEX)
+        {
+            return {locator, old_memory_begin, new_memory.get(), co_located_index(new_memory, new_max_element_count)};
+        }
+        else
+        {
+            return {locator,           old_memory_begin,      old_max_element_count,
+                    new_memory.get(), new_max_element_count, get_allocator()};
+        }
+    }
+
     template <class... Args>
     auto emplace_back_impl(Args&&... args)
     {
         return locator_->emplace_back(memory_begin(), locator_.fixed_sizes(), static_cast<Args&&>(args)...);
     }
 
+    template <class... Args>
+    void grow_if_needed([[maybe_unused]] const Args&... args)
+    {
+        if constexpr (IS_AUTO_GROWING)
+        {
+            if constexpr (ListTraits::IS_FIXED_SIZE_OR_PLAIN)
+            {
+                grow_if_needed_for(size_type{1}, size_type{});
+            }
+            else
+            {
+                grow_if_needed_for(size_type{1}, ElementTraits::max_size_in_memory_of(locator_.fixed_sizes(), args...));
+            }
+        }
+    }
+
+    void grow_if_needed_for([[maybe_unused]] size_type count, [[maybe_unused]] size_type needed_bytes)
+    {
+        if constexpr (IS_AUTO_GROWING)
+        {
+            const auto current_size = size();
+            const bool is_full = current_size + count > max_element_count_;
+            if constexpr (ListTraits::IS_FIXED_SIZE_OR_PLAIN)
+            {
+                if (is_full)
+                {
+                    grow(grown_size(max_element_count_, current_size + count), {});
+                }
+            }
+            else
+            {
+                const auto used_bytes = used_memory_consumption();
+                const auto memory_size = element_memory_consumption();
+                if (is_full || memory_size - used_bytes < needed_bytes)
+                {
+                    const auto new_max_element_count =
+                        is_full ? grown_size(max_element_count_, current_size + count) : max_element_count_;
+                    const auto new_memory_size = grown_size(memory_size, used_bytes + needed_bytes);
+                    const auto memory_size_without_varying_size = memory_size_for(new_max_element_count, {});
+                    grow(new_max_element_count, new_memory_size > memory_size_without_varying_size
+                                                    ? new_memory_size - memory_size_without_varying_size
+                                                    : size_type{});
+                }
+            }
+        }
+    }
+
+    /// Bytes occupied by the elements in `[first, last)` when they are laid out one after another starting at an
+    /// aligned address
+    template <class Iterator>
+    size_type size_in_memory_of(Iterator first, Iterator last) const noexcept
+    {
+        if constexpr (HAS_VARYING_SIZE)
+        {
+            size_type byte_count{};
+            for (; first != last; ++first)
+            {
+                byte_count += size_in_memory_of(*first, ListTraits::make_index_sequence());
+            }
+            return byte_count;
+        }
+        else
+        {
+            return locator_->stride() * static_cast<size_type>(std::distance(first, last));
+        }
+    }
+
+    template <class Element, std::size_t... I>
+    size_type size_in_memory_of(const Element& element, std::index_sequence<I...>) const noexcept
+    {
+        return ElementTraits::size_in_memory_of(locator_.fixed_sizes(), cntgs::get<I>(element)...);
+    }
+
+    template <class Element, std::size_t... I>
+    std::byte* emplace_element_at(std::byte* address, const Element& element, std::index_sequence<I...>)
+    {
+        return ElementTraits::emplace_at(address, locator_.fixed_sizes(), cntgs::get<I>(element)...);
+    }
+
+    template <class Element, std::size_t... I>
+    void emplace_back_element(const Element& element, std::index_sequence<I...>)
+    {
+        emplace_back_impl(cntgs::get<I>(element)...);
+    }
+
+    static constexpr size_type grown_size(size_type current, size_type minimum) noexcept
+    {
+        using GrowthFactor = typename ParsedOptions::GrowthFactor;
+        return (std::max)(minimum, current * GrowthFactor::NUMERATOR / GrowthFactor::DENOMINATOR);
+    }
+
+    [[nodiscard]] size_type memory_size_for(size_type max_element_count, size_type varying_size_bytes) const noexcept
+    {
+        return locator_->calculate_new_memory_size(max_element_count, varying_size_bytes, memory_.get_offset(),
+                                                   locator_.fixed_sizes());
+    }
+
+    [[nodiscard]] size_type used_memory_consumption() const noexcept
+    {
+        return static_cast<size_type>(locator_->data_end(memory_begin()) - memory_.allocation_begin());
+    }
+
+    [[nodiscard]] size_type element_memory_consumption() const noexcept
+    {
+        const auto begin = allocation_begin();
+        return static_cast<size_type>(locator_->memory_end(begin, begin + memory_consumption()) - begin);
+    }
+
     void grow(size_type new_max_element_count, size_type new_varying_size_bytes)
     {
-        const auto new_memory_size = locator_->calculate_new_memory_size(new_max_element_count, new_varying_size_bytes,
-                                                                         memory_.get_offset(), locator_.fixed_sizes());
+        const auto new_memory_size =
+            checked_memory_size(memory_size_for(new_max_element_count, new_varying_size_bytes)) +
+            co_located_index_memory_size(new_max_element_count);
+        if constexpr (CAN_REALLOCATE_IN_PLACE)
+        {
+            if (new_memory_size >= memory_consumption() && reallocate_in_place(new_max_element_count, new_memory_size))
+            {
+                return;
+            }
+        }
         auto new_memory = allocate_memory(new_memory_size, memory_.get_offset(), get_allocator());
-        ElementLocator other_locator{*locator_,        memory_begin(),        max_element_count_,
-                                     new_memory.get(), new_max_element_count, get_allocator()};
-        insert_into<true>(other_locator, new_max_element_count, new_memory, *this);
+        if constexpr (IS_CO_LOCATED_INDEX)
+        {
+            ElementLocator other_locator{*locator_, memory_begin(), new_memory.get(),
+                                         co_located_index(new_memory, new_max_element_count)};
+            reallocate(new_max_element_count, new_memory, other_locator);
+        }
+        else
+        {
+            ElementLocator other_locator{*locator_,        memory_begin(),        max_element_count_,
+                                         new_memory.get(), new_max_element_count, get_allocator()};
+            reallocate(new_max_element_count, new_memory, other_locator);
+        }
+    }
+
+    bool reallocate_in_place(size_type new_max_element_count, size_type new_memory_size)
+    {
+        // pointers into the old allocation are only used to compute offsets after it has been remapped
+        const auto old_allocation_begin = allocation_begin();
+        const auto old_memory_begin = memory_begin();
+        if (!memory_)
+        {
+            return false;
+        }
+        if constexpr (IS_CO_LOCATED_INDEX)
+        {
+            if (!memory_.reallocate(ElementTraits::storage_element_count(new_memory_size)))
+            {
+                return false;
+            }
+            locator_->relocate_index(old_allocation_begin, allocation_begin());
+            ElementLocator other_locator{*locator_, old_memory_begin, memory_begin(),
+                                         co_located_index(memory_, new_max_element_count)};
+            *locator_ = std::move(other_locator);
+        }
+        else
+        {
+            if constexpr (HAS_VARYING_SIZE && !IS_SCAN_ONLY)
+            {
+                if (locator_->is_index_within(old_allocation_begin, old_allocation_begin + memory_consumption()))
+                {
+                    return false;
+                }
+            }
+            // allocate the new index first so that a failure leaves the vector untouched
+            ElementLocator other_locator{*locator_,        old_memory_begin,      max_element_count_,
+                                         old_memory_begin, new_max_element_count, get_allocator()};
+            if (!memory_.reallocate(ElementTraits::storage_element_count(new_memory_size)))
+            {
+                const auto begin = allocation_begin();
+                other_locator.deallocate(new_max_element_count, begin, begin + memory_consumption(), get_allocator());
+                return false;
+            }
+            other_locator.rebase(old_memory_begin, memory_begin());
+            deallocate_index();
+            *locator_ = std::move(other_locator);
+        }
         max_element_count_ = new_max_element_count;
-        *locator_ = std::move(other_locator);
+        return true;
+    }
+
+    void reallocate(size_type new_max_element_count, StorageType& new_memory, ElementLocator& new_locator)
+    {
+        insert_into<true>(new_locator, new_max_element_count, new_memory, *this);
+        deallocate_index();
+        max_element_count_ = new_max_element_count;
+        *locator_ = std::move(new_locator);
         memory_.reset(std::move(new_memory));
     }
 
@@ -411,14 +963,16 @@ class BasicContiguousVector<cntgs::Options<Option...>, Parameter...>
         static constexpr auto USE_MOVE = !std::is_const_v<Self>;
         static constexpr auto IS_TRIVIAL =
             USE_MOVE ? ListTraits::IS_TRIVIALLY_MOVE_CONSTRUCTIBLE : ListTraits::IS_TRIVIALLY_COPY_CONSTRUCTIBLE;
+        static constexpr auto IS_RELOCATION = USE_MOVE && IsDestruct;
         auto* const mem = new_memory.get();
-        if constexpr (IS_TRIVIAL && (!IsDestruct || ListTraits::IS_TRIVIALLY_DESTRUCTIBLE))
+        if constexpr ((IS_TRIVIAL && (!IsDestruct || ListTraits::IS_TRIVIALLY_DESTRUCTIBLE)) ||
+                      (IS_RELOCATION && ListTraits::IS_TRIVIALLY_RELOCATABLE))
         {
             from.locator_->trivially_copy_into(from.memory_begin(), mem);
         }
         else
         {
-            std::memcpy(mem, from.memory_begin(), from.data_end() - from.memory_begin());
+            std::memcpy(mem, from.memory_begin(), from.locator_->data_end(from.memory_begin()) - from.memory_begin());
             BasicContiguousVector::uninitialized_construct_if_non_trivial<USE_MOVE>(from, mem, locator);
             if constexpr (IsDestruct)
             {
@@ -433,7 +987,17 @@ class BasicContiguousVector<cntgs::Options<Option...>, Parameter...>
     {
         static constexpr auto IS_TRIVIAL =
             UseMove ? ListTraits::IS_TRIVIALLY_MOVE_CONSTRUCTIBLE : ListTraits::IS_TRIVIALLY_COPY_CONSTRUCTIBLE;
-        if constexpr (!IS_TRIVIAL)
+        if constexpr (!IS_TRIVIAL && IS_SCAN_ONLY)
+        {
+            for (auto it = self.begin(); it != self.end(); ++it)
+            {
+                auto&& source = *it;
+                auto&& target = ElementTraits::template load_element_at<detail::ContiguousReferenceSizeGetter>(
+                    new_memory + (it.data() - self.memory_begin()), source);
+                ElementTraits::template construct_if_non_trivial<UseMove>(source, target);
+            }
+        }
+        else if constexpr (!IS_TRIVIAL)
         {
             for (size_type i{}; i < self.size(); ++i)
             {
@@ -447,10 +1011,20 @@ class BasicContiguousVector<cntgs::Options<Option...>, Parameter...>
 
     void move_elements_forward(std::size_t from, std::size_t to)
     {
-        if constexpr (ListTraits::IS_TRIVIALLY_MOVE_CONSTRUCTIBLE && ListTraits::IS_TRIVIALLY_DESTRUCTIBLE)
+        if constexpr (ListTraits::IS_TRIVIALLY_RELOCATABLE)
         {
             locator_->move_elements_forward(from, to, memory_begin());
         }
+        else if constexpr (IS_SAMPLED_INDEX)
+        {
+            locator_->move_elements_forward(from, to, memory_begin(),
+                                            [&](std::byte* source, std::byte* target)
+                                            {
+                                                return relocate_element(
+                                                    target, reference{source, locator_.fixed_sizes()},
+                                                    ListTraits::make_index_sequence());
+                                            });
+        }
         else
         {
             for (auto i = to; from != size(); ++i, (void)++from)
@@ -462,7 +1036,7 @@ class BasicContiguousVector<cntgs::Options<Option...>, Parameter...>
 
     void make_room_for_last_element_at(std::size_t from, [[maybe_unused]] std::size_t bytes)
     {
-        if constexpr (ListTraits::IS_TRIVIALLY_MOVE_CONSTRUCTIBLE && ListTraits::IS_TRIVIALLY_DESTRUCTIBLE)
+        if constexpr (ListTraits::IS_TRIVIALLY_RELOCATABLE)
         {
             locator_->make_room_for_last_element_at(from, bytes, memory_begin());
         }
@@ -475,6 +1049,262 @@ class BasicContiguousVector<cntgs::Options<Option...>, Parameter...>
         }
     }
 
+    /// Moves the elements starting at `from` back by `count` elements that occupy `bytes`, leaving their index entries
+    /// untouched
+    void move_elements_back(std::size_t from, [[maybe_unused]] std::size_t count, std::size_t bytes)
+    {
+        const auto current_size = size();
+        if (from == current_size)
+        {
+            return;
+        }
+        if constexpr (ListTraits::IS_TRIVIALLY_RELOCATABLE)
+        {
+            auto* const source = locator_->element_address(from, memory_begin());
+            auto* const source_end = ElementTraits::element_end(
+                locator_->element_address(current_size - std::size_t{1}, memory_begin()), locator_.fixed_sizes());
+            std::memmove(source + bytes, source, static_cast<std::size_t>(source_end - source));
+        }
+        else if constexpr (HAS_VARYING_SIZE)
+        {
+            for (auto i = current_size; i != from; --i)
+            {
+                auto* const source = locator_->element_address(i - std::size_t{1}, memory_begin());
+                auto&& element = reference{source, locator_.fixed_sizes()};
+                const auto element_size =
+                    static_cast<std::size_t>(ElementTraits::element_end(source, locator_.fixed_sizes()) - source);
+                if (bytes < element_size)
+                {
+                    relocate_element(source + bytes, element, ListTraits::make_index_sequence());
+                }
+                else
+                {
+                    move_element_to(source + bytes, element, ListTraits::make_index_sequence());
+                }
+            }
+        }
+        else
+        {
+            // shifted by whole elements, the source never overlaps the target
+            for (auto i = current_size; i != from; --i)
+            {
+                emplace_at(i - std::size_t{1} + count, (*this)[i - std::size_t{1}], ListTraits::make_index_sequence());
+            }
+        }
+    }
+
+    template <class Predicate>
+    size_type erase_if_impl(Predicate& predicate)
+    {
+        static_assert(!IS_SCAN_ONLY, "erase_if is not supported by ScanOnly vectors");
+        static_assert(!IS_SAMPLED_INDEX, "erase_if is not supported by vectors with a SampledIndex");
+        const auto current_size = size();
+        size_type first{};
+        while (first != current_size && !predicate((*this)[first]))
+        {
+            ++first;
+        }
+        if (first == current_size)
+        {
+            return {};
+        }
+        // a predicate that may throw is invoked for all elements before the first one is destroyed
+        static constexpr bool IS_NOTHROW_PREDICATE = std::is_nothrow_invocable_v<Predicate&, reference&>;
+        [[maybe_unused]] std::vector<bool> erased;
+        if constexpr (!IS_NOTHROW_PREDICATE)
+        {
+            erased.reserve(current_size - first - size_type{1});
+            for (auto i = first + size_type{1}; i != current_size; ++i)
+            {
+                auto&& element = (*this)[i];
+                erased.push_back(static_cast<bool>(predicate(element)));
+            }
+        }
+        const auto is_erased = [&](size_type i, reference& element)
+        {
+            if constexpr (IS_NOTHROW_PREDICATE)
+            {
+                return static_cast<bool>(predicate(element));
+            }
+            else
+            {
+                (void)element;
+                return static_cast<bool>(erased[i - first - size_type{1}]);
+            }
+        };
+        ElementTraits::destruct((*this)[first]);
+        auto* const memory = memory_begin();
+        auto* target = locator_->element_address(first, memory);
+        auto kept = first;
+        if constexpr (ListTraits::IS_TRIVIALLY_RELOCATABLE)
+        {
+            // survivors are moved in runs of consecutive elements, one memmove per run
+            std::byte* run_begin{};
+            const auto move_run = [&](std::byte* run_end)
+            {
+                const auto byte_count = static_cast<size_type>(run_end - run_begin);
+                std::memmove(target, run_begin, byte_count);
+                target += byte_count;
+                run_begin = nullptr;
+            };
+            for (auto i = first + size_type{1}; i != current_size; ++i)
+            {
+                auto* const source = locator_->element_address(i, memory);
+                auto&& element = reference{source, locator_.fixed_sizes()};
+                if (is_erased(i, element))
+                {
+                    ElementTraits::destruct(element);
+                    if (run_begin != nullptr)
+                    {
+                        move_run(source);
+                    }
+                    continue;
+                }
+                if (run_begin == nullptr)
+                {
+                    run_begin = source;
+                }
+                if constexpr (HAS_VARYING_SIZE)
+                {
+                    auto* const offsets = locator_->index_data();
+                    offsets[kept] = detail::to_element_offset<IndexType>(offsets[i] - (run_begin - target));
+                }
+                ++kept;
+            }
+            if (run_begin != nullptr)
+            {
+                move_run(ElementTraits::element_end(locator_->element_address(current_size - size_type{1}, memory),
+                                                    locator_.fixed_sizes()));
+            }
+        }
+        else
+        {
+            for (auto i = first + size_type{1}; i != current_size; ++i)
+            {
+                auto&& element = (*this)[i];
+                if (is_erased(i, element))
+                {
+                    ElementTraits::destruct(element);
+                    continue;
+                }
+                if constexpr (HAS_VARYING_SIZE)
+                {
+                    locator_->index_data()[kept] = detail::to_element_offset<IndexType>(target - memory);
+                    target = ElementTraits::align_for_first_parameter(
+                        relocate_element(target, element, ListTraits::make_index_sequence()));
+                }
+                else
+                {
+                    emplace_at(kept, element, ListTraits::make_index_sequence());
+                }
+                ++kept;
+            }
+        }
+        if constexpr (HAS_VARYING_SIZE)
+        {
+            locator_->assign_index(
+                kept, kept == size_type{}
+                          ? memory
+                          : ElementTraits::element_end(locator_->element_address(kept - size_type{1}, memory),
+                                                       locator_.fixed_sizes()));
+        }
+        else
+        {
+            locator_->resize(kept, memory);
+        }
+        return current_size - kept;
+    }
+
+    template <class Projection, class Compare>
+    void sort_impl(Projection& projection, Compare& compare)
+    {
+        static_assert(!HAS_VARYING_SIZE, "sort is not supported by vectors with VaryingSize parameters");
+        using Key = detail::RemoveCvrefT<std::invoke_result_t<Projection&, const_reference>>;
+        const auto current_size = size();
+        std::vector<std::pair<Key, size_type>> keys;
+        keys.reserve(current_size);
+        for (size_type i{}; i < current_size; ++i)
+        {
+            keys.emplace_back(std::invoke(projection, std::as_const(*this)[i]), i);
+        }
+        std::sort(keys.begin(), keys.end(),
+                  [&](const auto& lhs, const auto& rhs)
+                  {
+                      return std::invoke(compare, lhs.first, rhs.first);
+                  });
+        apply_permutation(keys);
+    }
+
+    /// Moves the element at `permutation[i].second` to position `i` by following the cycles of the permutation, every
+    /// element is relocated exactly once. Positions are marked as done by setting their entry to themselves.
+    template <class Key>
+    void apply_permutation(std::vector<std::pair<Key, size_type>>& permutation)
+    {
+        const auto current_size = size();
+        if (current_size == size_type{})
+        {
+            return;
+        }
+        auto* const memory = memory_begin();
+        [[maybe_unused]] std::unique_ptr<std::byte[]> buffer;
+        [[maybe_unused]] size_type element_size{};
+        if constexpr (ListTraits::IS_TRIVIALLY_RELOCATABLE)
+        {
+            auto* const first = locator_->element_address({}, memory);
+            element_size = static_cast<size_type>(ElementTraits::element_end(first, locator_.fixed_sizes()) - first);
+            buffer = std::make_unique<std::byte[]>(element_size);
+        }
+        for (size_type start{}; start < current_size; ++start)
+        {
+            if (permutation[start].second == start)
+            {
+                continue;
+            }
+            if constexpr (ListTraits::IS_TRIVIALLY_RELOCATABLE)
+            {
+                std::memcpy(buffer.get(), locator_->element_address(start, memory), element_size);
+                auto i = start;
+                for (auto from = permutation[i].second; from != start; i = from, from = permutation[i].second)
+                {
+                    std::memcpy(locator_->element_address(i, memory), locator_->element_address(from, memory),
+                                element_size);
+                    permutation[i].second = i;
+                }
+                std::memcpy(locator_->element_address(i, memory), buffer.get(), element_size);
+                permutation[i].second = i;
+            }
+            else
+            {
+                value_type element{std::move((*this)[start])};
+                auto i = start;
+                for (auto from = permutation[i].second; from != start; i = from, from = permutation[i].second)
+                {
+                    (*this)[i] = std::move((*this)[from]);
+                    permutation[i].second = i;
+                }
+                (*this)[i] = std::move(element);
+                permutation[i].second = i;
+            }
+        }
+    }
+
+    template <std::size_t... I>
+    std::byte* relocate_element(std::byte* target, reference source, std::index_sequence<I...>)
+    {
+        // Compacting elements forward, or shifting them back, can move an element by less than its own size. The source
+        // may then overlap the target, so it is moved out into a temporary before being destructed.
+        value_type element{std::move(source)};
+        ElementTraits::destruct(source);
+        return ElementTraits::emplace_at_aliased(target, locator_.fixed_sizes(), std::move(cntgs::get<I>(element))...);
+    }
+
+    template <std::size_t... I>
+    void move_element_to(std::byte* target, const reference& source, std::index_sequence<I...>)
+    {
+        ElementTraits::emplace_at(target, locator_.fixed_sizes(), std::move(cntgs::get<I>(source))...);
+        ElementTraits::destruct(source);
+    }
+
     template <std::size_t... I>
     void emplace_at(std::size_t i, const reference& element, std::index_sequence<I...>)
     {
@@ -485,6 +1315,7 @@ class BasicContiguousVector<cntgs::Options<Option...>, Parameter...>
     constexpr void steal(BasicContiguousVector&& other) noexcept
     {
         destruct();
+        deallocate_index();
         max_element_count_ = other.max_element_count_;
         memory_ = std::move(other.memory_);
         locator_ = std::move(other.locator_);
@@ -509,20 +1340,20 @@ class BasicContiguousVector<cntgs::Options<Option...>, Parameter...>
                 {
                     // allocate memory first because it might throw
                     StorageType new_memory{other.memory_consumption(), get_allocator()};
-                    ElementLocatorAndFixedSizes other_locator{other.locator_,           other.memory_begin(),
-                                                              other.max_element_count_, new_memory.get(),
-                                                              other.max_element_count_, get_allocator()};
+                    auto other_locator = copy_locator(other.locator_, other.memory_begin(), other.max_element_count_,
+                                                      new_memory, other.max_element_count_);
                     destruct();
+                    deallocate_index();
                     BasicContiguousVector::insert_into(*other_locator, other.max_element_count_, new_memory, other);
                     memory_ = std::move(new_memory);
                     locator_ = std::move(other_locator);
                 }
                 else
                 {
-                    ElementLocatorAndFixedSizes other_locator{other.locator_,           other.memory_begin(),
-                                                              other.max_element_count_, memory_begin(),
-                                                              other.max_element_count_, get_allocator()};
+                    auto other_locator = copy_locator(other.locator_, other.memory_begin(), other.max_element_count_,
+                                                      memory_, other.max_element_count_);
                     destruct();
+                    deallocate_index();
                     BasicContiguousVector::insert_into(*other_locator, other.max_element_count_, memory_, other);
                     locator_ = std::move(other_locator);
                 }
@@ -533,8 +1364,8 @@ class BasicContiguousVector<cntgs::Options<Option...>, Parameter...>
 
     auto copy_construct_locator(const BasicContiguousVector& other)
     {
-        ElementLocatorAndFixedSizes other_locator{other.locator_, other.memory_begin(),     other.max_element_count_,
-                                                  memory_begin(), other.max_element_count_, get_allocator()};
+        auto other_locator = copy_locator(other.locator_, other.memory_begin(), other.max_element_count_, memory_,
+                                          other.max_element_count_);
         BasicContiguousVector::insert_into(*other_locator, other.max_element_count_, memory_, other);
         return other_locator;
     }
@@ -542,9 +1373,10 @@ class BasicContiguousVector<cntgs::Options<Option...>, Parameter...>
     void copy_assign(const BasicContiguousVector& other)
     {
         destruct();
+        deallocate_index();
         memory_ = other.memory_;
-        ElementLocatorAndFixedSizes other_locator{other.locator_, other.memory_begin(),     other.max_element_count_,
-                                                  memory_begin(), other.max_element_count_, get_allocator()};
+        auto other_locator = copy_locator(other.locator_, other.memory_begin(), other.max_element_count_, memory_,
+                                          other.max_element_count_);
         BasicContiguousVector::insert_into(*other_locator, other.max_element_count_, memory_, other);
         max_element_count_ = other.max_element_count_;
         locator_ = std::move(other_locator);
@@ -605,6 +1437,12 @@ class BasicContiguousVector<cntgs::Options<Option...>, Parameter...>
 
     constexpr void destruct() noexcept { BasicContiguousVector::destruct(begin(), end()); }
 
+    void deallocate_index() noexcept
+    {
+        const auto begin = allocation_begin();
+        locator_->deallocate(max_element_count_, begin, begin + memory_consumption(), get_allocator());
+    }
+
     static constexpr void destruct([[maybe_unused]] iterator first, [[maybe_unused]] iterator last) noexcept
     {
         if constexpr (!ListTraits::IS_TRIVIALLY_DESTRUCTIBLE)
@@ -613,6 +1451,37 @@ class BasicContiguousVector<cntgs::Options<Option...>, Parameter...>
         }
     }
 };
+
+/// Erases all elements for which `predicate` returns true. The remaining elements keep their order and are compacted in
+/// a single forward sweep, runs of consecutive remaining elements are moved with one `memmove` each if all parameters
+/// are trivially relocatable. The element index is rewritten once. Not supported by [cntgs::ScanOnly]() and
+/// [cntgs::SampledIndex]() vectors.
+///
+/// \param predicate Invoked once with a [cntgs::BasicContiguousVector::reference]() to each element, in order. Unless
+/// it is `noexcept`, it is invoked for all elements before the first one is destroyed, so that an exception thrown by
+/// it leaves the vector unchanged.
+/// \returns The number of erased elements
+template <class... Option, class... Parameter, class Predicate>
+std::size_t erase_if(cntgs::BasicContiguousVector<cntgs::Options<Option...>, Parameter...>& vector,
+                     Predicate predicate)
+{
+    return vector.erase_if_impl(predicate);
+}
+
+/// Sorts the elements by the keys that `projection` returns for them. The keys are computed once and sorted together
+/// with the position of their element, then the elements are moved into their final position by following the cycles
+/// of the resulting permutation. Every element is relocated exactly once, with a single `memcpy` if all parameters are
+/// trivially relocatable, instead of being swapped through proxy references. The order of elements with equivalent keys
+/// is unspecified. Only available for vectors without [cntgs::VaryingSize]() parameters.
+///
+/// \param projection Invoked once with a [cntgs::BasicContiguousVector::const_reference]() to each element
+/// \param compare Strict weak ordering of the keys
+template <class... Option, class... Parameter, class Projection, class Compare>
+void sort(cntgs::BasicContiguousVector<cntgs::Options<Option...>, Parameter...>& vector, Projection projection,
+          Compare compare)
+{
+    vector.sort_impl(projection, compare);
+}
 }  // namespace cntgs
 
 #endif  // CNTGS_CNTGS_VECTOR_HPP
@@ -0,0 +1,192 @@
+// Copyright (c) 2021 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef CNTGS_CNTGS_VECTORVIEW_HPP
+#define CNTGS_CNTGS_VECTORVIEW_HPP
+
+#include "cntgs/detail/elementLocator.hpp"
+#include "cntgs/detail/elementTraits.hpp"
+#include "cntgs/detail/forward.hpp"
+#include "cntgs/detail/optionsParser.hpp"
+#include "cntgs/detail/parameterListTraits.hpp"
+#include "cntgs/iterator.hpp"
+#include "cntgs/parameter.hpp"
+#include "cntgs/vector.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace cntgs
+{
+/// Alias template for [cntgs::BasicContiguousVectorView]() without options
+template <class... Parameter>
+using ContiguousVectorView = cntgs::BasicContiguousVectorView<cntgs::Options<>, Parameter...>;
+
+/// Non-owning, read-only view of elements laid out like those of a [cntgs::BasicContiguousVector]() in memory that is
+/// owned by someone else, like a mapped file, shared memory or a network buffer. Offers the same element access as the
+/// vector without copying the elements.
+///
+/// \param Option Any of the options of [cntgs::BasicContiguousVector](), only [cntgs::IndexType]() affects the view.
+/// [cntgs::ScanOnly]() and [cntgs::SampledIndex]() are not supported.
+/// \param Parameter The parameters of the vector whose layout the memory follows
+template <class... Option, class... Parameter>
+class BasicContiguousVectorView<cntgs::Options<Option...>, Parameter...>
+{
+  private:
+    using Vector = cntgs::BasicContiguousVector<cntgs::Options<Option...>, Parameter...>;
+    using ParsedOptions = detail::OptionsParser<Option...>;
+    using ListTraits = detail::ParameterListTraits<Parameter...>;
+    using ElementTraits = detail::ElementTraitsT<Parameter...>;
+    using ElementLocator = detail::ElementLocatorT<ParsedOptions, Parameter...>;
+    using ElementLocatorAndFixedSizes = detail::ElementLocatorAndFixedSizes<ElementLocator, Parameter...>;
+    using FixedSizes = typename ListTraits::FixedSizes;
+    using FixedSizesArray = typename ListTraits::FixedSizesArray;
+
+    static constexpr bool HAS_VARYING_SIZE = !ListTraits::IS_FIXED_SIZE_OR_PLAIN;
+
+    static_assert(!HAS_VARYING_SIZE || (!ParsedOptions::ScanOnly::value && ParsedOptions::SampledIndex::STRIDE <= 1),
+                  "views of ScanOnly and SampledIndex vectors are not supported");
+
+  public:
+    using value_type = typename Vector::value_type;
+    using reference = typename Vector::const_reference;
+    using const_reference = typename Vector::const_reference;
+    using iterator = cntgs::ContiguousVectorIterator<true, cntgs::Options<Option...>, Parameter...>;
+    using const_iterator = iterator;
+    using difference_type = std::ptrdiff_t;
+    using size_type = std::size_t;
+    using index_type = typename ParsedOptions::IndexType;
+
+    BasicContiguousVectorView() = default;
+
+    /// Views `size` elements of a vector without [cntgs::VaryingSize]() parameters
+    ///
+    /// \param memory Beginning of the element storage, aligned like the storage of a [cntgs::BasicContiguousVector]().
+    /// Equal to the address of the first element unless the first parameter is over-aligned.
+    template <bool HasVaryingSize = HAS_VARYING_SIZE>
+    BasicContiguousVectorView(const std::byte* memory, size_type size, const FixedSizes& fixed_sizes = {},
+                              std::enable_if_t<!HasVaryingSize>* = nullptr) noexcept
+        : BasicContiguousVectorView(memory, nullptr, size, FixedSizesArray{fixed_sizes})
+    {
+    }
+
+    /// Views `size` elements of a vector with [cntgs::VaryingSize]() parameters
+    ///
+    /// \param memory Beginning of the element storage, aligned like the storage of a [cntgs::BasicContiguousVector]()
+    /// \param index Offset of each of the `size` elements relative to `memory`, no terminating offset is required
+    template <bool HasVaryingSize = HAS_VARYING_SIZE>
+    BasicContiguousVectorView(const std::byte* memory, const index_type* index, size_type size,
+                              const FixedSizes& fixed_sizes = {}, std::enable_if_t<HasVaryingSize>* = nullptr) noexcept
+        : BasicContiguousVectorView(memory, index, size, FixedSizesArray{fixed_sizes})
+    {
+    }
+
+    /*implicit*/ BasicContiguousVectorView(const Vector& vector) noexcept
+        : BasicContiguousVectorView(vector.memory_.get(), index_of(vector), vector.size(),
+                                    vector.locator_.fixed_sizes())
+    {
+    }
+
+    [[nodiscard]] const_reference operator[](size_type i) const noexcept
+    {
+        return const_reference{locator_->element_address(i, memory_), locator_.fixed_sizes()};
+    }
+
+    [[nodiscard]] const_reference front() const noexcept { return (*this)[{}]; }
+
+    [[nodiscard]] const_reference back() const noexcept { return (*this)[size() - size_type{1}]; }
+
+    /// Same as [cntgs::BasicContiguousVector::prefetch]()
+    void prefetch(size_type i, cntgs::PrefetchLocality locality = cntgs::PrefetchLocality::HIGH) const noexcept
+    {
+        detail::prefetch_element(*locator_, i, memory_, locality);
+    }
+
+    /// Same as [cntgs::BasicContiguousVector::for_each_index]()
+    template <class Indices, class Function>
+    void for_each_index(const Indices& indices, Function&& function) const
+    {
+        detail::for_each_index(*locator_, memory_, indices,
+                               [&](std::byte* address)
+                               {
+                                   function(const_reference{address, locator_.fixed_sizes()});
+                               });
+    }
+
+    template <std::size_t I>
+    [[nodiscard]] size_type get_fixed_size() const noexcept
+    {
+        return detail::get<I>(locator_.fixed_sizes());
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return locator_->empty(memory_); }
+
+    [[nodiscard]] const std::byte* data() const noexcept { return locator_->element_address({}, memory_); }
+
+    [[nodiscard]] size_type size() const noexcept { return locator_->size(memory_); }
+
+    [[nodiscard]] const_iterator begin() const noexcept { return const_iterator{mutable_locator(), memory_, {}}; }
+
+    [[nodiscard]] const_iterator cbegin() const noexcept { return begin(); }
+
+    [[nodiscard]] const_iterator end() const noexcept { return const_iterator{mutable_locator(), memory_, size()}; }
+
+    [[nodiscard]] const_iterator cend() const noexcept { return end(); }
+
+  private:
+    template <class>
+    friend class MappedContiguousVector;
+
+    BasicContiguousVectorView(const std::byte* memory, const index_type* index, size_type size,
+                              const FixedSizesArray& fixed_sizes) noexcept
+        : memory_(const_cast<std::byte*>(memory)), locator_(make_locator(memory_, index, size, fixed_sizes))
+    {
+    }
+
+    static const index_type* index_of([[maybe_unused]] const Vector& vector) noexcept
+    {
+        if constexpr (HAS_VARYING_SIZE)
+        {
+            return vector.locator_->index_data();
+        }
+        else
+        {
+            return nullptr;
+        }
+    }
+
+    static ElementLocatorAndFixedSizes make_locator(std::byte* memory, [[maybe_unused]] const index_type* index,
+                                                    size_type size, const FixedSizesArray& fixed_sizes) noexcept
+    {
+        const auto element_size = ElementTraits::calculate_element_size(fixed_sizes);
+        if constexpr (HAS_VARYING_SIZE)
+        {
+            ElementLocatorAndFixedSizes locator{size, memory, fixed_sizes, element_size,
+                                                const_cast<index_type*>(index)};
+            const auto last_element =
+                size == 0 ? memory : ElementTraits::element_end(memory + index[size - 1], fixed_sizes);
+            locator->assign_index(size, last_element);
+            return locator;
+        }
+        else
+        {
+            ElementLocatorAndFixedSizes locator{size, memory, fixed_sizes, element_size, std::allocator<std::byte>{}};
+            locator->resize(size, memory);
+            return locator;
+        }
+    }
+
+    ElementLocatorAndFixedSizes& mutable_locator() const noexcept
+    {
+        return const_cast<ElementLocatorAndFixedSizes&>(locator_);
+    }
+
+    std::byte* memory_{};
+    ElementLocatorAndFixedSizes locator_;
+};
+}  // namespace cntgs
+
+#endif  // CNTGS_CNTGS_VECTORVIEW_HPP
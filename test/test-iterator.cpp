@@ -81,4 +81,63 @@ TEST_CASE("ContiguousIterator: std::rotate with ContiguousVectorIterator of Fixe
     check_equal_using_get(vector[0], array_one_unique_ptr(30), 40);
     check_equal_using_get(vector[1], array_one_unique_ptr(10), 20);
 }
+
+TEST_CASE("ContiguousIterator: ScanOnly OneVarying begin() end()")
+{
+    using Vector = cntgs::BasicContiguousVector<cntgs::Options<cntgs::ScanOnly>, uint32_t,
+                                                cntgs::AlignAs<std::size_t, 8>, cntgs::VaryingSize<float>>;
+    Vector vector{3, 10 * sizeof(float)};
+    CHECK_EQ(vector.begin(), vector.end());
+    vector.emplace_back(10u, FLOATS1.size(), FLOATS1);
+    vector.emplace_back(20u, FLOATS2.size(), FLOATS2);
+    auto begin = vector.begin();
+    using IterTraits = std::iterator_traits<decltype(begin)>;
+    CHECK(std::is_same_v<std::forward_iterator_tag, typename IterTraits::iterator_category>);
+    CHECK_EQ(vector.data_begin(), begin.data());
+    check_equal_using_get(*begin, 10u, FLOATS1.size(), FLOATS1);
+    Vector::const_iterator next = std::next(begin);
+    CHECK_EQ(1, next.index());
+    check_equal_using_get(*next, 20u, FLOATS2.size(), FLOATS2);
+    CHECK_EQ(vector.end(), std::next(next));
+    CHECK_EQ(2, std::distance(vector.begin(), vector.end()));
+}
+
+TEST_CASE("ContiguousIterator: SampledIndex OneVarying begin() end()")
+{
+    using Vector = cntgs::BasicContiguousVector<cntgs::Options<cntgs::SampledIndex<4>>, uint32_t,
+                                                cntgs::AlignAs<std::size_t, 8>, cntgs::VaryingSize<float>>;
+    Vector vector{8, 8 * FLOATS2.size() * sizeof(float)};
+    CHECK_EQ(vector.begin(), vector.end());
+    for (uint32_t i{}; i < 8; ++i)
+    {
+        if (i % 2 == 0)
+        {
+            vector.emplace_back(i, FLOATS1.size(), FLOATS1);
+        }
+        else
+        {
+            vector.emplace_back(i, FLOATS2.size(), FLOATS2);
+        }
+    }
+    using IterTraits = std::iterator_traits<Vector::iterator>;
+    CHECK(std::is_same_v<std::random_access_iterator_tag, typename IterTraits::iterator_category>);
+    std::size_t i{};
+    for (auto it = vector.begin(); it != vector.end(); ++it, ++i)
+    {
+        CHECK_EQ(vector[i].data_begin(), it.data());
+        CHECK_EQ(i, cntgs::get<0>(*it));
+    }
+    CHECK_EQ(8, i);
+    auto end = vector.begin();
+    std::advance(end, 8);
+    CHECK_EQ(vector.end(), end);
+    CHECK_EQ(vector.data_end(), end.data());
+    CHECK_EQ(vector.data_end(), vector.end().data());
+    Vector::const_iterator last = std::prev(vector.end());
+    CHECK_EQ(7, last.index());
+    check_equal_using_get(*last, 7u, FLOATS2.size(), FLOATS2);
+    CHECK_EQ(vector[5].data_begin(), (last - 2).data());
+    CHECK_EQ(vector[2].data_begin(), vector.begin()[2].data_begin());
+    CHECK_EQ(8, std::distance(vector.begin(), vector.end()));
+}
 }  // namespace test_iterator
@@ -13,6 +13,7 @@
 
 #include <array>
 #include <list>
+#include <numeric>
 #include <string>
 #include <vector>
 #include <version>
@@ -366,6 +367,51 @@ TEST_CASE("ContiguousVector: std::unique_ptr VaryingSize reserve and shrink")
     check_equal_using_get(vector[2], 1, array_one_unique_ptr(), 20);
 }
 
+TEST_CASE("ContiguousVector: OneVarying varying_capacity() and varying_size()")
+{
+    OneVarying vector{2, FLOATS1.size() * sizeof(float)};
+    CHECK_LE(FLOATS1.size() * sizeof(float), vector.varying_capacity());
+    CHECK_EQ(0, vector.varying_size());
+    vector.emplace_back(10u, FLOATS1.size(), FLOATS1);
+    CHECK_EQ(FLOATS1.size() * sizeof(float), vector.varying_size());
+}
+
+TEST_CASE("ContiguousVector: OneVarying reserve_bytes")
+{
+    OneVarying vector{2, FLOATS1.size() * sizeof(float)};
+    vector.emplace_back(10u, FLOATS1.size(), FLOATS1);
+    const auto new_varying_size_bytes = (FLOATS1.size() + FLOATS2.size()) * sizeof(float);
+    vector.reserve_bytes(new_varying_size_bytes);
+    CHECK_EQ(2, vector.capacity());
+    CHECK_LE(new_varying_size_bytes, vector.varying_capacity());
+    vector.emplace_back(20u, FLOATS2.size(), FLOATS2);
+    check_equal_using_get(vector[0], 10u, FLOATS1.size(), FLOATS1);
+    check_equal_using_get(vector[1], 20u, FLOATS2.size(), FLOATS2);
+}
+
+TEST_CASE("ContiguousVector: OneVaryingUniquePtr reserve_bytes")
+{
+    OneVaryingUniquePtr vector{2, 2 * sizeof(std::unique_ptr<int>)};
+    vector.emplace_back(1, array_one_unique_ptr(10), std::make_unique<int>(20));
+    vector.reserve_bytes(3 * sizeof(std::unique_ptr<int>));
+    CHECK_EQ(2, vector.capacity());
+    vector.emplace_back(2, array_two_unique_ptr(30, 40), std::make_unique<int>(50));
+    check_equal_using_get(vector[0], 1, array_one_unique_ptr(10), 20);
+    check_equal_using_get(vector[1], 2, array_two_unique_ptr(30, 40), 50);
+}
+
+TEST_CASE("ContiguousVector: OneVarying reserve does not shrink varying_capacity()")
+{
+    OneVarying vector{1, 10 * sizeof(float)};
+    const auto varying_capacity = vector.varying_capacity();
+    vector.reserve(2);
+    CHECK_EQ(2, vector.capacity());
+    CHECK_LE(varying_capacity, vector.varying_capacity());
+    vector.reserve(2, 20 * sizeof(float));
+    CHECK_EQ(2, vector.capacity());
+    CHECK_LE(20 * sizeof(float), vector.varying_capacity());
+}
+
 TEST_CASE("ContiguousVector: trivial OneFixed reserve with polymorphic_allocator")
 {
     TestPmrMemoryResource resource;
@@ -375,4 +421,262 @@ TEST_CASE("ContiguousVector: trivial OneFixed reserve with polymorphic_allocator
     vector.emplace_back(std::array{1.f}, 10);
     resource.check_was_used(vector.get_allocator());
 }
+
+TEST_CASE("ContiguousVector: GrowthFactor Plain emplace_back beyond capacity")
+{
+    cntgs::BasicContiguousVector<cntgs::Options<cntgs::GrowthFactor<2>>, uint32_t, float> vector{0};
+    for (uint32_t i{}; i < 100; ++i)
+    {
+        vector.emplace_back(i, float(i));
+    }
+    CHECK_EQ(100, vector.size());
+    CHECK_EQ(128, vector.capacity());
+    for (uint32_t i{}; i < 100; ++i)
+    {
+        check_equal_using_get(vector[i], i, float(i));
+    }
+}
+
+TEST_CASE("ContiguousVector: GrowthFactor OneFixedUniquePtr emplace_back beyond capacity")
+{
+    cntgs::BasicContiguousVector<cntgs::Options<cntgs::GrowthFactor<3, 2>>, cntgs::FixedSize<std::unique_ptr<int>>,
+                                 std::unique_ptr<int>>
+        vector{1, {1}};
+    for (int i{}; i < 10; ++i)
+    {
+        vector.emplace_back(array_one_unique_ptr(i), std::make_unique<int>(i + 1));
+    }
+    CHECK_EQ(10, vector.size());
+    for (int i{}; i < 10; ++i)
+    {
+        check_equal_using_get(vector[i], array_one_unique_ptr(i), i + 1);
+    }
+}
+
+TEST_CASE("ContiguousVector: GrowthFactor OneVarying emplace_back beyond capacity")
+{
+    cntgs::BasicContiguousVector<cntgs::Options<cntgs::GrowthFactor<2>>, uint32_t, cntgs::AlignAs<std::size_t, 8>,
+                                 cntgs::VaryingSize<float>>
+        vector{1, 0};
+    std::vector<float> floats;
+    for (uint32_t i{}; i < 50; ++i)
+    {
+        floats.resize(i % 7);
+        std::fill(floats.begin(), floats.end(), float(i));
+        vector.emplace_back(i, floats.size(), floats);
+    }
+    CHECK_EQ(50, vector.size());
+    for (uint32_t i{}; i < 50; ++i)
+    {
+        floats.resize(i % 7);
+        std::fill(floats.begin(), floats.end(), float(i));
+        check_equal_using_get(vector[i], i, floats.size(), floats);
+    }
+}
+
+TEST_CASE("ContiguousVector: GrowthFactor OneVarying emplace_back grows varying size bytes only")
+{
+    cntgs::BasicContiguousVector<cntgs::Options<cntgs::GrowthFactor<2>>, uint32_t, cntgs::AlignAs<std::size_t, 8>,
+                                 cntgs::VaryingSize<float>>
+        vector{4, FLOATS1.size() * sizeof(float)};
+    vector.emplace_back(10u, FLOATS1.size(), FLOATS1);
+    vector.emplace_back(20u, FLOATS2.size(), FLOATS2);
+    CHECK_EQ(4, vector.capacity());
+    check_equal_using_get(vector[0], 10u, FLOATS1.size(), FLOATS1);
+    check_equal_using_get(vector[1], 20u, FLOATS2.size(), FLOATS2);
+}
+
+TEST_CASE("ContiguousVector: GrowthFactor OneVaryingUniquePtr emplace_back beyond capacity")
+{
+    cntgs::BasicContiguousVector<cntgs::Options<cntgs::GrowthFactor<2>>, cntgs::AlignAs<std::size_t, 8>,
+                                 cntgs::VaryingSize<std::unique_ptr<int>>, std::unique_ptr<int>>
+        vector{0, 0};
+    for (int i{}; i < 10; ++i)
+    {
+        vector.emplace_back(2, array_two_unique_ptr(i, i + 1), std::make_unique<int>(i + 2));
+    }
+    CHECK_EQ(10, vector.size());
+    for (int i{}; i < 10; ++i)
+    {
+        check_equal_using_get(vector[i], 2, array_two_unique_ptr(i, i + 1), i + 2);
+    }
+}
+
+template <class Vector>
+void emplace_back_with_varying_size(Vector& vector, const std::vector<uint32_t>& ids)
+{
+    for (auto id : ids)
+    {
+        const std::vector<float> floats(id % 5, float(id));
+        vector.emplace_back(id, floats.size(), floats);
+    }
+}
+
+template <class Vector>
+void check_equal_with_varying_size(const Vector& vector, const std::vector<uint32_t>& ids)
+{
+    REQUIRE((ids.size() == vector.size()));
+    for (std::size_t i{}; i < ids.size(); ++i)
+    {
+        const std::vector<float> floats(ids[i] % 5, float(ids[i]));
+        CHECK(check_equal_using_get(vector[i], ids[i], floats.size(), floats));
+    }
+}
+
+TEST_CASE("ContiguousVector: OneVarying insert")
+{
+    OneVarying vector{9, 9 * 5 * sizeof(float)};
+    emplace_back_with_varying_size(vector, {1, 2, 3, 4});
+    OneVarying source{3, 3 * 5 * sizeof(float)};
+    emplace_back_with_varying_size(source, {11, 12, 13});
+    std::size_t index{};
+    std::vector<uint32_t> expected;
+    SUBCASE("at begin")
+    {
+        index = 0;
+        expected = {11, 12, 13, 1, 2, 3, 4};
+    }
+    SUBCASE("in the middle")
+    {
+        index = 1;
+        expected = {1, 11, 12, 13, 2, 3, 4};
+    }
+    SUBCASE("at end")
+    {
+        index = 4;
+        expected = {1, 2, 3, 4, 11, 12, 13};
+    }
+    const auto it = vector.insert(std::next(vector.begin(), index), source.begin(), source.end());
+    CHECK_EQ(std::next(vector.begin(), index), it);
+    check_equal_with_varying_size(vector, expected);
+    vector.insert(vector.begin(), source.begin(), source.begin());
+    emplace_back_with_varying_size(vector, {5, 6});
+    expected.insert(expected.end(), {5, 6});
+    check_equal_with_varying_size(vector, expected);
+}
+
+TEST_CASE("ContiguousVector: OneFixed insert")
+{
+    OneFixed vector{5, {FLOATS1.size()}};
+    vector.emplace_back(10u, FLOATS1);
+    vector.emplace_back(20u, FLOATS1_ALT);
+    const std::vector<OneFixed::value_type> elements{vector[1], vector[0], vector[1]};
+    const auto it = vector.insert(std::next(vector.begin()), elements.begin(), elements.end());
+    CHECK_EQ(std::next(vector.begin()), it);
+    CHECK_EQ(5, vector.size());
+    CHECK(check_equal_using_get(vector[0], 10u, FLOATS1));
+    CHECK(check_equal_using_get(vector[1], 20u, FLOATS1_ALT));
+    CHECK(check_equal_using_get(vector[2], 10u, FLOATS1));
+    CHECK(check_equal_using_get(vector[3], 20u, FLOATS1_ALT));
+    CHECK(check_equal_using_get(vector[4], 20u, FLOATS1_ALT));
+}
+
+TEST_CASE("ContiguousVector: std::string insert")
+{
+    SUBCASE("FixedSize")
+    {
+        cntgs::ContiguousVector<cntgs::FixedSize<std::string>, std::string> vector{4, {1}};
+        vector.emplace_back(std::vector{STRING1}, STRING1);
+        vector.emplace_back(std::vector{STRING1}, STRING2);
+        cntgs::ContiguousVector<cntgs::FixedSize<std::string>, std::string> copy{vector};
+        vector.insert(vector.begin(), copy.begin(), copy.end());
+        CHECK_EQ(4, vector.size());
+        CHECK(check_equal_using_get(vector[0], std::vector{STRING1}, STRING1));
+        CHECK(check_equal_using_get(vector[1], std::vector{STRING1}, STRING2));
+        CHECK(check_equal_using_get(vector[2], std::vector{STRING1}, STRING1));
+        CHECK(check_equal_using_get(vector[3], std::vector{STRING1}, STRING2));
+    }
+    SUBCASE("VaryingSize")
+    {
+        using Vector =
+            cntgs::ContiguousVector<uint32_t, cntgs::AlignAs<std::size_t, 8>, cntgs::VaryingSize<std::string>>;
+        Vector vector{5, 10 * sizeof(std::string)};
+        vector.emplace_back(1u, std::size_t{1}, std::array{STRING1});
+        vector.emplace_back(2u, std::size_t{2}, std::array{STRING1, STRING2});
+        Vector source{2, 3 * sizeof(std::string)};
+        source.emplace_back(3u, std::size_t{2}, std::array{STRING2, STRING1});
+        source.emplace_back(4u, std::size_t{1}, std::array{STRING2});
+        vector.insert(std::next(vector.begin()), source.begin(), source.end());
+        CHECK_EQ(4, vector.size());
+        CHECK(check_equal_using_get(vector[0], 1u, std::size_t{1}, std::array{STRING1}));
+        CHECK(check_equal_using_get(vector[1], 3u, std::size_t{2}, std::array{STRING2, STRING1}));
+        CHECK(check_equal_using_get(vector[2], 4u, std::size_t{1}, std::array{STRING2}));
+        CHECK(check_equal_using_get(vector[3], 2u, std::size_t{2}, std::array{STRING1, STRING2}));
+    }
+    SUBCASE("VaryingSize shifted by less than an element")
+    {
+        using Vector =
+            cntgs::ContiguousVector<uint32_t, cntgs::AlignAs<std::size_t, 8>, cntgs::VaryingSize<std::string>>;
+        Vector vector{3, 5 * sizeof(std::string)};
+        vector.emplace_back(1u, std::size_t{3}, std::array{STRING1, STRING2, STRING1});
+        vector.emplace_back(2u, std::size_t{1}, std::array{STRING2});
+        Vector source{1, sizeof(std::string)};
+        source.emplace_back(3u, std::size_t{1}, std::array{STRING1});
+        vector.insert(vector.begin(), source.begin(), source.end());
+        CHECK_EQ(3, vector.size());
+        CHECK(check_equal_using_get(vector[0], 3u, std::size_t{1}, std::array{STRING1}));
+        CHECK(check_equal_using_get(vector[1], 1u, std::size_t{3}, std::array{STRING1, STRING2, STRING1}));
+        CHECK(check_equal_using_get(vector[2], 2u, std::size_t{1}, std::array{STRING2}));
+    }
+}
+
+TEST_CASE("ContiguousVector: GrowthFactor OneVarying insert and append_range beyond capacity")
+{
+    cntgs::BasicContiguousVector<cntgs::Options<cntgs::GrowthFactor<2>>, uint32_t, cntgs::AlignAs<std::size_t, 8>,
+                                 cntgs::VaryingSize<float>>
+        vector{1, 0};
+    emplace_back_with_varying_size(vector, {1});
+    OneVarying source{20, 20 * 5 * sizeof(float)};
+    std::vector<uint32_t> ids(20);
+    std::iota(ids.begin(), ids.end(), 10u);
+    emplace_back_with_varying_size(source, ids);
+    vector.insert(vector.begin(), source.begin(), std::next(source.begin(), 10));
+    vector.append_range(source);
+    std::vector<uint32_t> expected(ids.begin(), std::next(ids.begin(), 10));
+    expected.push_back(1);
+    expected.insert(expected.end(), ids.begin(), ids.end());
+    check_equal_with_varying_size(vector, expected);
+}
+
+TEST_CASE("ContiguousVector: GrowthFactor insert and append_range of an empty range do not grow")
+{
+    using Vector = cntgs::BasicContiguousVector<cntgs::Options<cntgs::GrowthFactor<2>>, uint32_t,
+                                                cntgs::VaryingSize<std::string>, cntgs::AlignAs<uint64_t, 8>>;
+    Vector vector{1, sizeof(std::string)};
+    vector.emplace_back(1u, std::array{STRING1}, uint64_t{2});
+    const auto memory_consumption = vector.memory_consumption();
+    const Vector empty{0, 0};
+    CHECK_EQ(vector.end(), vector.insert(vector.end(), empty.begin(), empty.end()));
+    vector.append_range(empty);
+    CHECK_EQ(memory_consumption, vector.memory_consumption());
+    CHECK_EQ(1, vector.size());
+}
+
+TEST_CASE("ContiguousVector: append_range grows the memory at most once")
+{
+    OneVarying source{10, 10 * 5 * sizeof(float)};
+    emplace_back_with_varying_size(source, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+    SUBCASE("GrowthFactor")
+    {
+        cntgs::BasicContiguousVector<cntgs::Options<cntgs::GrowthFactor<2>>, uint32_t, cntgs::AlignAs<std::size_t, 8>,
+                                     cntgs::VaryingSize<float>>
+            vector{0, 0};
+        vector.append_range(source);
+        CHECK_EQ(10, vector.capacity());
+        check_equal_with_varying_size(vector, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+    }
+    SUBCASE("ScanOnly")
+    {
+        cntgs::BasicContiguousVector<cntgs::Options<cntgs::GrowthFactor<2>, cntgs::ScanOnly>, uint32_t,
+                                     cntgs::AlignAs<std::size_t, 8>, cntgs::VaryingSize<float>>
+            vector{0, 0};
+        vector.append_range(source);
+        std::vector<uint32_t> ids;
+        for (auto&& element : vector)
+        {
+            ids.push_back(cntgs::get<0>(element));
+        }
+        CHECK_EQ((std::vector<uint32_t>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}), ids);
+    }
+}
 }  // namespace test_vector_emplace
@@ -11,6 +11,10 @@
 #include <cntgs/contiguous.hpp>
 
 #include <array>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 namespace test_vector_erase
 {
@@ -155,4 +159,200 @@ TEST_CASE("ContiguousVector: TwoVarying erase(Iterator, Iterator)")
         check_equal_using_get(vector.front(), 10u, FLOATS1.size(), FLOATS1, FLOATS2.size(), FLOATS2);
     }
 }
+
+TEST_CASE("ContiguousVector: OneVarying erase_if")
+{
+    OneVarying vector{11, 11 * 4 * sizeof(float)};
+    for (uint32_t i{}; i < 10; ++i)
+    {
+        const std::vector<float> floats(i % 5, float(i));
+        vector.emplace_back(i, floats.size(), floats);
+    }
+    std::function<bool(uint32_t)> predicate;
+    std::vector<uint32_t> expected;
+    SUBCASE("none")
+    {
+        predicate = [](uint32_t) { return false; };
+        expected = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    }
+    SUBCASE("all")
+    {
+        predicate = [](uint32_t) { return true; };
+    }
+    SUBCASE("every third")
+    {
+        predicate = [](uint32_t id) { return id % 3 == 1; };
+        expected = {0, 2, 3, 5, 6, 8, 9};
+    }
+    SUBCASE("runs at the front and back")
+    {
+        predicate = [](uint32_t id) { return id < 2 || id > 6; };
+        expected = {2, 3, 4, 5, 6};
+    }
+    std::vector<uint32_t> visited;
+    const auto erased = cntgs::erase_if(vector,
+                                        [&](auto&& element)
+                                        {
+                                            visited.push_back(cntgs::get<0>(element));
+                                            return predicate(cntgs::get<0>(element));
+                                        });
+    CHECK_EQ((std::vector<uint32_t>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}), visited);
+    CHECK_EQ(10 - expected.size(), erased);
+    vector.emplace_back(10u, FLOATS2.size(), FLOATS2);
+    expected.push_back(10);
+    REQUIRE((expected.size() == vector.size()));
+    for (std::size_t i{}; i + 1 < expected.size(); ++i)
+    {
+        const std::vector<float> floats(expected[i] % 5, float(expected[i]));
+        CHECK(check_equal_using_get(vector[i], expected[i], floats.size(), floats));
+    }
+    CHECK(check_equal_using_get(vector.back(), 10u, FLOATS2.size(), FLOATS2));
+}
+
+TEST_CASE("ContiguousVector: OneFixed erase_if")
+{
+    OneFixed vector{5, {FLOATS1.size()}};
+    for (uint32_t i{}; i < 5; ++i)
+    {
+        vector.emplace_back(i, i % 2 == 0 ? FLOATS1 : FLOATS1_ALT);
+    }
+    CHECK_EQ(2, cntgs::erase_if(vector,
+                                [](auto&& element)
+                                {
+                                    return cntgs::get<0>(element) % 2 == 1;
+                                }));
+    CHECK_EQ(3, vector.size());
+    CHECK(check_equal_using_get(vector[0], 0u, FLOATS1));
+    CHECK(check_equal_using_get(vector[1], 2u, FLOATS1));
+    CHECK(check_equal_using_get(vector[2], 4u, FLOATS1));
+}
+
+TEST_CASE("ContiguousVector: erase_if non-trivial types")
+{
+    SUBCASE("OneFixedUniquePtr")
+    {
+        OneFixedUniquePtr vector{4, {1}};
+        for (int i{}; i < 4; ++i)
+        {
+            vector.emplace_back(array_one_unique_ptr(i), std::make_unique<int>(i + 10));
+        }
+        CHECK_EQ(2, cntgs::erase_if(vector,
+                                    [](auto&& element)
+                                    {
+                                        return *cntgs::get<1>(element) < 12;
+                                    }));
+        CHECK_EQ(2, vector.size());
+        CHECK(check_equal_using_get(vector[0], array_one_unique_ptr(2), 12));
+        CHECK(check_equal_using_get(vector[1], array_one_unique_ptr(3), 13));
+    }
+    SUBCASE("FixedSize std::string")
+    {
+        cntgs::ContiguousVector<cntgs::FixedSize<std::string>, std::string> vector{3, {1}};
+        vector.emplace_back(std::array{STRING1}, STRING1);
+        vector.emplace_back(std::array{STRING2}, STRING2);
+        vector.emplace_back(std::array{STRING1}, STRING2);
+        CHECK_EQ(1, cntgs::erase_if(vector,
+                                    [](auto&& element)
+                                    {
+                                        return cntgs::get<1>(element) == STRING1;
+                                    }));
+        CHECK_EQ(2, vector.size());
+        CHECK(check_equal_using_get(vector[0], std::array{STRING2}, STRING2));
+        CHECK(check_equal_using_get(vector[1], std::array{STRING1}, STRING2));
+    }
+    SUBCASE("VaryingSize std::string")
+    {
+        cntgs::ContiguousVector<uint32_t, cntgs::AlignAs<std::size_t, 8>, cntgs::VaryingSize<std::string>> vector{
+            4, 6 * sizeof(std::string)};
+        vector.emplace_back(1u, std::size_t{1}, std::array{STRING1});
+        vector.emplace_back(2u, std::size_t{2}, std::array{STRING1, STRING2});
+        vector.emplace_back(3u, std::size_t{1}, std::array{STRING2});
+        vector.emplace_back(4u, std::size_t{2}, std::array{STRING2, STRING1});
+        CHECK_EQ(2, cntgs::erase_if(vector,
+                                    [](auto&& element)
+                                    {
+                                        return cntgs::get<0>(element) % 2 == 1;
+                                    }));
+        CHECK_EQ(2, vector.size());
+        CHECK(check_equal_using_get(vector[0], 2u, std::size_t{2}, std::array{STRING1, STRING2}));
+        CHECK(check_equal_using_get(vector[1], 4u, std::size_t{2}, std::array{STRING2, STRING1}));
+    }
+}
+
+#ifdef __cpp_exceptions
+TEST_CASE("ContiguousVector: erase_if with a throwing predicate leaves the vector unchanged")
+{
+    cntgs::ContiguousVector<uint32_t, cntgs::AlignAs<std::size_t, 8>, cntgs::VaryingSize<std::string>> vector{
+        3, 4 * sizeof(std::string)};
+    vector.emplace_back(1u, std::size_t{1}, std::array{STRING1});
+    vector.emplace_back(2u, std::size_t{2}, std::array{STRING1, STRING2});
+    vector.emplace_back(3u, std::size_t{1}, std::array{STRING2});
+    int calls{};
+    bool has_thrown{};
+    try
+    {
+        cntgs::erase_if(vector,
+                        [&](auto&&)
+                        {
+                            if (++calls == 2)
+                            {
+                                throw std::runtime_error{"predicate"};
+                            }
+                            return true;
+                        });
+    }
+    catch (const std::runtime_error&)
+    {
+        has_thrown = true;
+    }
+    CHECK(has_thrown);
+    CHECK_EQ(3, vector.size());
+    CHECK(check_equal_using_get(vector[0], 1u, std::size_t{1}, std::array{STRING1}));
+    CHECK(check_equal_using_get(vector[1], 2u, std::size_t{2}, std::array{STRING1, STRING2}));
+    CHECK(check_equal_using_get(vector[2], 3u, std::size_t{1}, std::array{STRING2}));
+}
+#endif
+
+TEST_CASE("ContiguousVector: OneFixed erase_unordered")
+{
+    OneFixed vector{3, {FLOATS1.size()}};
+    vector.emplace_back(10u, FLOATS1);
+    vector.emplace_back(20u, FLOATS1_ALT);
+    vector.emplace_back(30u, FLOATS1);
+    auto it = vector.erase_unordered(vector.begin());
+    CHECK_EQ(vector.begin(), it);
+    CHECK_EQ(2, vector.size());
+    CHECK(check_equal_using_get(vector[0], 30u, FLOATS1));
+    CHECK(check_equal_using_get(vector[1], 20u, FLOATS1_ALT));
+    it = vector.erase_unordered(std::next(vector.begin()));
+    CHECK_EQ(vector.end(), it);
+    CHECK_EQ(1, vector.size());
+    CHECK(check_equal_using_get(vector[0], 30u, FLOATS1));
+    vector.emplace_back(40u, FLOATS1_ALT);
+    CHECK(check_equal_using_get(vector[1], 40u, FLOATS1_ALT));
+}
+
+TEST_CASE("ContiguousVector: erase_unordered non-trivial types")
+{
+    SUBCASE("OneFixedUniquePtr")
+    {
+        OneFixedUniquePtr vector{3, {1}};
+        vector.emplace_back(array_one_unique_ptr(10), std::make_unique<int>(20));
+        vector.emplace_back(array_one_unique_ptr(30), std::make_unique<int>(40));
+        vector.emplace_back(array_one_unique_ptr(50), std::make_unique<int>(60));
+        vector.erase_unordered(std::next(vector.begin()));
+        CHECK_EQ(2, vector.size());
+        CHECK(check_equal_using_get(vector[0], array_one_unique_ptr(10), 20));
+        CHECK(check_equal_using_get(vector[1], array_one_unique_ptr(50), 60));
+    }
+    SUBCASE("FixedSize std::string")
+    {
+        cntgs::ContiguousVector<cntgs::FixedSize<std::string>, std::string> vector{2, {1}};
+        vector.emplace_back(std::array{STRING1}, STRING1);
+        vector.emplace_back(std::array{STRING2}, STRING2);
+        vector.erase_unordered(vector.begin());
+        CHECK_EQ(1, vector.size());
+        CHECK(check_equal_using_get(vector[0], std::array{STRING2}, STRING2));
+    }
+}
 }  // namespace test_vector_erase
@@ -11,19 +11,55 @@
 #include "utils/typedefs.hpp"
 
 #include <cntgs/contiguous.hpp>
+#include <cntgs/fileWriter.hpp>
+#include <cntgs/serialize.hpp>
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
 #include <version>
 
 #ifdef __cpp_lib_span
 #include <span>
 #endif
 
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#if __has_include(<sys/mman.h>)
+#include <cntgs/mappedVector.hpp>
+#include <cntgs/mmapAllocator.hpp>
+#endif
+
 namespace test_vector
 {
 using namespace cntgs;
 using namespace test;
 
+// the test binaries of all language standards may run concurrently, every process writes its own file
+std::string unique_file_path(const char* name)
+{
+#ifdef _WIN32
+    const auto pid = ::_getpid();
+#else
+    const auto pid = ::getpid();
+#endif
+    return std::string{name} + "-" + std::to_string(pid) + ".bin";
+}
+
 TEST_CASE("ContiguousVector: TwoFixed get_fixed_size<I>()")
 {
     TwoFixed vector{2, {10, 20}};
@@ -49,6 +85,75 @@ TEST_CASE("ContiguousVector: one fixed one varying size: correct memory_consumpt
 #endif
 }
 
+TEST_CASE("ContiguousVector: IndexType reduces memory of the element index")
+{
+    using Options = cntgs::Options<cntgs::Allocator<TestAllocator<>>, cntgs::IndexType<uint16_t>>;
+    using NarrowVector =
+        cntgs::BasicContiguousVector<Options, uint32_t, cntgs::AlignAs<std::size_t, 8>, cntgs::VaryingSize<float>>;
+    using WideVector = ContiguousVectorWithAllocator<TestAllocator<>, uint32_t, cntgs::AlignAs<std::size_t, 8>,
+                                                     cntgs::VaryingSize<float>>;
+    const auto element_count = 4;
+    TestMemoryResource narrow_resource;
+    TestMemoryResource wide_resource;
+    {
+        NarrowVector narrow{element_count, 10 * sizeof(float), narrow_resource.get_allocator()};
+        WideVector wide{element_count, 10 * sizeof(float), wide_resource.get_allocator()};
+        CHECK_EQ(wide_resource.bytes_allocated,
+                 narrow_resource.bytes_allocated + element_count * (sizeof(std::size_t) - sizeof(uint16_t)));
+        narrow.emplace_back(10u, FLOATS1.size(), FLOATS1);
+        narrow.emplace_back(20u, FLOATS2.size(), FLOATS2);
+        narrow.emplace_back(30u, FLOATS1.size(), FLOATS1);
+        narrow.erase(narrow.begin());
+        check_equal_using_get(narrow[0], 20u, FLOATS2.size(), FLOATS2);
+        check_equal_using_get(narrow[1], 30u, FLOATS1.size(), FLOATS1);
+        narrow.freeze();
+        check_equal_using_get(narrow[1], 30u, FLOATS1.size(), FLOATS1);
+        CHECK_EQ(2, std::distance(narrow.begin(), narrow.end()));
+    }
+    CHECK_EQ(narrow_resource.bytes_allocated, narrow_resource.bytes_deallocated);
+}
+
+#ifdef __cpp_exceptions
+TEST_CASE("ContiguousVector: IndexType throws when the element storage exceeds its range")
+{
+    using Vector = cntgs::BasicContiguousVector<cntgs::Options<cntgs::IndexType<uint8_t>>, uint32_t,
+                                                cntgs::VaryingSize<float>>;
+    const auto throws_length_error = [](auto&& function)
+    {
+        try
+        {
+            function();
+        }
+        catch (const std::length_error&)
+        {
+            return true;
+        }
+        return false;
+    };
+    CHECK(throws_length_error(
+        []
+        {
+            Vector{2, 256 * sizeof(float)};
+        }));
+    Vector vector{2, 10 * sizeof(float)};
+    vector.emplace_back(10u, FLOATS1);
+    CHECK(throws_length_error(
+        [&]
+        {
+            vector.reserve(2, 256 * sizeof(float));
+        }));
+    CHECK(throws_length_error(
+        [&]
+        {
+            vector.reserve_bytes(256 * sizeof(float));
+        }));
+    CHECK_EQ(1, vector.size());
+    check_equal_using_get(vector[0], 10u, FLOATS1);
+    vector.reserve(4, 40 * sizeof(float));
+    CHECK_EQ(4, vector.capacity());
+}
+#endif
+
 TEST_CASE("ContiguousVector: TwoFixed correct memory_consumption()")
 {
     TwoFixed vector{2, {1, 2}};
@@ -75,6 +180,109 @@ TEST_CASE("ContiguousVector: OneVarying subscript operator returns a reference")
     }
 }
 
+TEST_CASE("ContiguousVector: prefetch leaves the elements unchanged")
+{
+    SUBCASE("fixed size")
+    {
+        OneFixed vector{2, {FLOATS1.size()}};
+        vector.emplace_back(10u, FLOATS1);
+        vector.emplace_back(20u, FLOATS1);
+        vector.prefetch(0);
+        vector.prefetch(1, cntgs::PrefetchLocality::NONE);
+        check_equal_using_get(vector[0], 10u, FLOATS1);
+        check_equal_using_get(vector[1], 20u, FLOATS1);
+    }
+    SUBCASE("varying size")
+    {
+        OneVarying vector{2, FLOATS1.size() * sizeof(float) + FLOATS2.size() * sizeof(float)};
+        vector.emplace_back(10u, FLOATS1.size(), FLOATS1);
+        vector.emplace_back(20u, FLOATS2.size(), FLOATS2);
+        for (auto locality : {cntgs::PrefetchLocality::NONE, cntgs::PrefetchLocality::LOW,
+                              cntgs::PrefetchLocality::MODERATE, cntgs::PrefetchLocality::HIGH})
+        {
+            vector.prefetch(0, locality);
+            vector.prefetch(1, locality);
+        }
+        const cntgs::ContiguousVectorView<uint32_t, cntgs::AlignAs<std::size_t, 8>, cntgs::VaryingSize<float>> view{
+            vector};
+        view.prefetch(1, cntgs::PrefetchLocality::LOW);
+        check_equal_using_get(vector[0], 10u, FLOATS1.size(), FLOATS1);
+        check_equal_using_get(view[1], 20u, FLOATS2.size(), FLOATS2);
+    }
+    SUBCASE("sampled index")
+    {
+        using Vector = cntgs::BasicContiguousVector<cntgs::Options<cntgs::SampledIndex<2>>, uint32_t,
+                                                    cntgs::AlignAs<std::size_t, 8>, cntgs::VaryingSize<float>>;
+        Vector vector{3, 3 * FLOATS1.size() * sizeof(float)};
+        for (uint32_t i{}; i < 3; ++i)
+        {
+            vector.emplace_back(i, FLOATS1.size(), FLOATS1);
+        }
+        vector.prefetch(2);
+        CHECK_EQ(2u, cntgs::get<0>(vector[2]));
+    }
+}
+
+template <class Vector>
+auto collect_first_parameter_using_for_each_index(Vector& vector, const std::vector<std::size_t>& indices)
+{
+    std::vector<uint32_t> result;
+    vector.for_each_index(indices,
+                          [&](auto&& element)
+                          {
+                              result.push_back(cntgs::get<0>(element));
+                          });
+    return result;
+}
+
+TEST_CASE("ContiguousVector: for_each_index visits the elements in the order of the indices")
+{
+    std::vector<std::size_t> indices;
+    std::vector<uint32_t> expected;
+    SUBCASE("no indices") {}
+    SUBCASE("fewer indices than the prefetch distance")
+    {
+        indices = {4, 0, 4};
+        expected = {4, 0, 4};
+    }
+    SUBCASE("more indices than the prefetch distance")
+    {
+        for (std::size_t i{}; i < 50; ++i)
+        {
+            indices.push_back(i * 7 % 10);
+            expected.push_back(static_cast<uint32_t>(i * 7 % 10));
+        }
+    }
+    OneFixed fixed{10, {FLOATS1.size()}};
+    OneVarying varying{10, 10 * FLOATS1.size() * sizeof(float)};
+    cntgs::BasicContiguousVector<cntgs::Options<cntgs::SampledIndex<4>>, uint32_t, cntgs::AlignAs<std::size_t, 8>,
+                                 cntgs::VaryingSize<float>>
+        sampled{10, 10 * FLOATS1.size() * sizeof(float)};
+    for (uint32_t i{}; i < 10; ++i)
+    {
+        fixed.emplace_back(i, FLOATS1);
+        const std::vector<float> floats(i % 3, static_cast<float>(i));
+        varying.emplace_back(i, floats.size(), floats);
+        sampled.emplace_back(i, floats.size(), floats);
+    }
+    CHECK_EQ(expected, collect_first_parameter_using_for_each_index(fixed, indices));
+    CHECK_EQ(expected, collect_first_parameter_using_for_each_index(std::as_const(varying), indices));
+    CHECK_EQ(expected, collect_first_parameter_using_for_each_index(sampled, indices));
+    const cntgs::ContiguousVectorView<uint32_t, cntgs::AlignAs<std::size_t, 8>, cntgs::VaryingSize<float>> view{
+        varying};
+    CHECK_EQ(expected, collect_first_parameter_using_for_each_index(view, indices));
+    varying.for_each_index(indices,
+                           [](auto&& element)
+                           {
+                               cntgs::get<0>(element) += 100;
+                           });
+    for (uint32_t i{}; i < 10; ++i)
+    {
+        const auto count = std::count(indices.begin(), indices.end(), i);
+        CHECK_EQ(i + 100 * count, cntgs::get<0>(varying[i]));
+    }
+}
+
 template <bool IsNoexcept>
 using NoexceptVector = cntgs::ContiguousVector<cntgs::FixedSize<Noexcept<IsNoexcept>>>;
 
@@ -200,4 +408,812 @@ TEST_CASE("ContiguousVector: OneVaryingString clear")
     vector.emplace_back(2, std::array{STRING2, STRING2}, STRING2);
     check_equal_using_get(vector[0], 2, std::array{STRING2, STRING2}, STRING2);
 }
+
+TEST_CASE("ContiguousVector: Plain shrink_to_fit")
+{
+    Plain vector{10};
+    vector.emplace_back(10u, 1.f);
+    vector.emplace_back(20u, 2.f);
+    const auto memory_consumption = vector.memory_consumption();
+    vector.shrink_to_fit();
+    CHECK_EQ(2, vector.capacity());
+    CHECK_GT(memory_consumption, vector.memory_consumption());
+    check_equal_using_get(vector[0], 10u, 1.f);
+    check_equal_using_get(vector[1], 20u, 2.f);
+}
+
+TEST_CASE("ContiguousVector: OneVarying shrink_to_fit")
+{
+    auto vector = one_varying_vector_four_elements();
+    vector.reserve(10, 100 * sizeof(float));
+    const auto varying_size = vector.varying_size();
+    vector.shrink_to_fit();
+    CHECK_EQ(4, vector.capacity());
+    CHECK_EQ(varying_size, vector.varying_size());
+    CHECK_GT(alignof(std::size_t), vector.varying_capacity() - vector.varying_size());
+    check_equal_using_get(vector[1], 20u, 3u, std::array{11.f, 12.f, 13.f});
+    check_equal_using_get(vector[3], 15u, 3u, floats1(10.f, 20.f, 30.f));
+}
+
+TEST_CASE("ContiguousVector: OneVaryingUniquePtr shrink_to_fit releases all memory")
+{
+    TestMemoryResource resource;
+    {
+        auto vector = varying_vector_of_unique_ptrs(resource.get_allocator());
+        vector.reserve(4, 10 * sizeof(std::unique_ptr<int>));
+        vector.shrink_to_fit();
+        CHECK_EQ(2, vector.capacity());
+        check_equal_using_get(vector[0], 2, array_two_unique_ptr(10, 20), 30);
+        check_equal_using_get(vector[1], 1, array_one_unique_ptr(40), 50);
+    }
+    CHECK_EQ(resource.bytes_allocated, resource.bytes_deallocated);
+}
+
+TEST_CASE("ContiguousVector: OneVarying freeze")
+{
+    auto vector = one_varying_vector_four_elements();
+    vector.freeze();
+    CHECK_EQ(4, vector.capacity());
+    check_equal_using_get(vector[0], 10u, FLOATS1.size(), FLOATS1);
+    check_equal_using_get(vector[3], 15u, 3u, floats1(10.f, 20.f, 30.f));
+    const auto copy = vector;
+    check_equal_using_get(copy[1], 20u, 3u, std::array{11.f, 12.f, 13.f});
+    vector.freeze();
+    check_equal_using_get(vector[3], 15u, 3u, floats1(10.f, 20.f, 30.f));
+}
+
+TEST_CASE("ContiguousVector: OneVaryingUniquePtr freeze and grow again")
+{
+    TestMemoryResource resource;
+    {
+        auto vector = varying_vector_of_unique_ptrs(resource.get_allocator());
+        vector.freeze();
+        check_equal_using_get(vector[0], 2, array_two_unique_ptr(10, 20), 30);
+        check_equal_using_get(vector[1], 1, array_one_unique_ptr(40), 50);
+        vector.reserve(3, vector.varying_capacity() + sizeof(std::unique_ptr<int>));
+        vector.emplace_back(1, array_one_unique_ptr(60), std::make_unique<int>(70));
+        check_equal_using_get(vector[0], 2, array_two_unique_ptr(10, 20), 30);
+        check_equal_using_get(vector[2], 1, array_one_unique_ptr(60), 70);
+    }
+    CHECK_EQ(resource.bytes_allocated, resource.bytes_deallocated);
+}
+struct RelocatableCounter
+{
+    static inline int move_constructions{};
+
+    std::unique_ptr<int> value;
+
+    explicit RelocatableCounter(int value) : value(std::make_unique<int>(value)) {}
+
+    RelocatableCounter(RelocatableCounter&& other) noexcept : value(std::move(other.value)) { ++move_constructions; }
+
+    RelocatableCounter& operator=(RelocatableCounter&& other) noexcept
+    {
+        value = std::move(other.value);
+        return *this;
+    }
+};
+}  // namespace test_vector
+
+template <>
+struct cntgs::is_trivially_relocatable<test_vector::RelocatableCounter> : std::true_type
+{
+};
+
+namespace test_vector
+{
+TEST_CASE("ContiguousVector: is_trivially_relocatable defaults")
+{
+    CHECK(cntgs::is_trivially_relocatable_v<float>);
+    CHECK(cntgs::is_trivially_relocatable_v<std::unique_ptr<int>>);
+    CHECK_FALSE(cntgs::is_trivially_relocatable_v<std::string>);
+    CHECK_FALSE(std::is_trivially_move_constructible_v<RelocatableCounter>);
+}
+
+TEST_CASE("ContiguousVector: trivially relocatable elements are not move constructed")
+{
+    using Vector = cntgs::ContiguousVector<cntgs::FixedSize<RelocatableCounter>, RelocatableCounter>;
+    Vector vector{3, {1}};
+    RelocatableCounter::move_constructions = 0;
+    vector.emplace_back(std::array{RelocatableCounter{10}}, RelocatableCounter{20});
+    vector.emplace_back(std::array{RelocatableCounter{30}}, RelocatableCounter{40});
+    const auto constructions_per_element = RelocatableCounter::move_constructions / 2;
+    vector.reserve(6);
+    vector.erase(vector.begin());
+    vector.emplace(vector.begin(), std::array{RelocatableCounter{50}}, RelocatableCounter{60});
+    CHECK_EQ(3 * constructions_per_element, RelocatableCounter::move_constructions);
+    CHECK_EQ(2, vector.size());
+    auto&& [first_array, first_value] = vector[0];
+    CHECK_EQ(50, *first_array[0].value);
+    CHECK_EQ(60, *first_value.value);
+    auto&& [second_array, second_value] = vector[1];
+    CHECK_EQ(30, *second_array[0].value);
+    CHECK_EQ(40, *second_value.value);
+}
+
+TEST_CASE("ContiguousVector: ScanOnly does not allocate an element index")
+{
+    using Vector = cntgs::BasicContiguousVector<cntgs::Options<cntgs::Allocator<TestAllocator<>>, cntgs::ScanOnly>,
+                                                uint32_t, cntgs::AlignAs<std::size_t, 8>, cntgs::VaryingSize<float>>;
+    TestMemoryResource resource;
+    {
+        Vector vector{2, 5 * sizeof(float), resource.get_allocator()};
+        CHECK_EQ(vector.memory_consumption(), resource.bytes_allocated);
+        vector.emplace_back(10u, FLOATS1.size(), FLOATS1);
+        vector.emplace_back(20u, FLOATS2.size(), FLOATS2);
+        CHECK_EQ(2, vector.size());
+        vector.clear();
+        CHECK(vector.empty());
+        vector.emplace_back(30u, FLOATS2.size(), FLOATS2);
+        check_equal_using_get(*vector.begin(), 30u, FLOATS2.size(), FLOATS2);
+    }
+    CHECK_EQ(resource.bytes_allocated, resource.bytes_deallocated);
+}
+
+TEST_CASE("ContiguousVector: ScanOnly OneVaryingUniquePtr grow and copy")
+{
+    using Vector =
+        cntgs::BasicContiguousVector<cntgs::Options<cntgs::GrowthFactor<2>, cntgs::ScanOnly>,
+                                     cntgs::AlignAs<std::size_t, 8>, cntgs::VaryingSize<std::unique_ptr<int>>, int>;
+    Vector vector{1, sizeof(std::unique_ptr<int>)};
+    for (int i{}; i < 10; ++i)
+    {
+        vector.emplace_back(1, array_one_unique_ptr(i), i * 10);
+    }
+    CHECK_EQ(10, vector.size());
+    int i{};
+    for (auto&& [size, pointers, value] : vector)
+    {
+        CHECK_EQ(1, size);
+        CHECK_EQ(i, *pointers[0]);
+        CHECK_EQ(i * 10, value);
+        ++i;
+    }
+    CHECK_EQ(10, i);
+    auto moved = std::move(vector);
+    vector = std::move(moved);
+    vector.shrink_to_fit();
+    CHECK_EQ(10, vector.capacity());
+    CHECK_EQ(9, *cntgs::get<1>(*std::next(vector.begin(), 9))[0]);
+}
+template <class Vector>
+void check_sampled_elements(const Vector& vector, const std::vector<uint32_t>& expected)
+{
+    CHECK_EQ(expected.size(), vector.size());
+    for (std::size_t i{}; i < expected.size(); ++i)
+    {
+        auto&& [value, size, floats] = vector[i];
+        CHECK_EQ(expected[i], value);
+        CHECK_EQ(expected[i] % 4, size);
+        CHECK_EQ(expected[i] % 4, floats.size());
+    }
+}
+
+TEST_CASE("ContiguousVector: SampledIndex random access, erase and freeze")
+{
+    using Vector = cntgs::BasicContiguousVector<cntgs::Options<cntgs::SampledIndex<4>>, uint32_t,
+                                                cntgs::AlignAs<std::size_t, 8>, cntgs::VaryingSize<float>>;
+    Vector vector{11, 11 * 3 * sizeof(float)};
+    std::vector<uint32_t> expected;
+    for (uint32_t i{}; i < 11; ++i)
+    {
+        vector.emplace_back(i, i % 4, std::vector<float>(i % 4, static_cast<float>(i)));
+        expected.push_back(i);
+    }
+    check_sampled_elements(vector, expected);
+    vector.erase(std::next(vector.begin(), 2));
+    expected.erase(std::next(expected.begin(), 2));
+    check_sampled_elements(vector, expected);
+    vector.erase(std::next(vector.begin(), 3), std::next(vector.begin(), 8));
+    expected.erase(std::next(expected.begin(), 3), std::next(expected.begin(), 8));
+    check_sampled_elements(vector, expected);
+    vector.pop_back();
+    expected.pop_back();
+    vector.freeze();
+    check_sampled_elements(vector, expected);
+    const auto copy = vector;
+    check_sampled_elements(copy, expected);
+    CHECK_EQ(expected.size(), std::distance(copy.begin(), copy.end()));
+}
+
+TEST_CASE("ContiguousVector: SampledIndex std::string erase")
+{
+    using Vector = cntgs::BasicContiguousVector<cntgs::Options<cntgs::SampledIndex<2>>, uint32_t,
+                                                cntgs::VaryingSize<std::string>, std::string>;
+    Vector vector{5, 10 * sizeof(std::string)};
+    for (uint32_t i{}; i < 5; ++i)
+    {
+        vector.emplace_back(i, std::vector<std::string>(i, std::string(32, 'a' + i)), std::to_string(i));
+    }
+    vector.erase(vector.begin());
+    CHECK_EQ(4, vector.size());
+    for (uint32_t i{}; i < 4; ++i)
+    {
+        auto&& [size, strings, string] = vector[i];
+        CHECK_EQ(i + 1, size);
+        CHECK_EQ(std::vector<std::string>(i + 1, std::string(32, 'a' + i + 1)),
+                 std::vector<std::string>(strings.begin(), strings.end()));
+        CHECK_EQ(std::to_string(i + 1), string);
+    }
+}
+
+TEST_CASE("ContiguousVector: SampledIndex reduces memory of the element index")
+{
+    using Options = cntgs::Options<cntgs::Allocator<TestAllocator<>>, cntgs::SampledIndex<16>>;
+    using Vector = cntgs::BasicContiguousVector<Options, uint32_t, cntgs::VaryingSize<float>>;
+    TestMemoryResource resource;
+    {
+        Vector vector{64, 10 * sizeof(float), resource.get_allocator()};
+        CHECK_EQ(vector.memory_consumption() + 4 * sizeof(std::size_t), resource.bytes_allocated);
+    }
+    CHECK_EQ(resource.bytes_allocated, resource.bytes_deallocated);
+}
+
+TEST_CASE("ContiguousVector: CoLocatedIndex uses a single allocation")
+{
+    using Options = cntgs::Options<cntgs::Allocator<TestAllocator<>>, cntgs::GrowthFactor<2>, cntgs::CoLocatedIndex>;
+    using Vector =
+        cntgs::BasicContiguousVector<Options, uint32_t, cntgs::AlignAs<std::size_t, 8>, cntgs::VaryingSize<float>>;
+    TestMemoryResource resource;
+    {
+        Vector vector{1, sizeof(float), resource.get_allocator()};
+        CHECK_EQ(vector.memory_consumption(), resource.bytes_allocated);
+        CHECK_LE(sizeof(float), vector.varying_capacity());
+        for (uint32_t i{}; i < 5; ++i)
+        {
+            vector.emplace_back(i, FLOATS1.size(), FLOATS1);
+            vector.emplace_back(i + 10, FLOATS2.size(), FLOATS2);
+        }
+        CHECK_EQ(10, vector.size());
+        CHECK_EQ(resource.bytes_allocated - resource.bytes_deallocated, vector.memory_consumption());
+        vector.erase(vector.begin());
+        check_equal_using_get(vector[0], 10u, FLOATS2.size(), FLOATS2);
+        check_equal_using_get(vector[8], 14u, FLOATS2.size(), FLOATS2);
+        const auto allocated = resource.bytes_allocated;
+        Vector copy{vector};
+        CHECK_EQ(allocated + copy.memory_consumption(), resource.bytes_allocated);
+        check_equal_using_get(copy[1], 1u, FLOATS1.size(), FLOATS1);
+        copy.freeze();
+        CHECK_EQ(9, copy.capacity());
+        check_equal_using_get(copy[8], 14u, FLOATS2.size(), FLOATS2);
+        vector = copy;
+        check_equal_using_get(vector[7], 4u, FLOATS1.size(), FLOATS1);
+        Vector moved{std::move(copy)};
+        check_equal_using_get(moved[7], 4u, FLOATS1.size(), FLOATS1);
+    }
+    CHECK_EQ(resource.bytes_allocated, resource.bytes_deallocated);
+}
+
+TEST_CASE("ContiguousVector: serialize and deserialize")
+{
+    std::stringstream stream;
+    SUBCASE("fixed size")
+    {
+        TwoFixedAlignedAlt vector{2, {FLOATS1.size(), 2}};
+        vector.emplace_back(FLOATS1, std::array{1u, 2u}, 10u);
+        vector.emplace_back(FLOATS1, std::array{3u, 4u}, 20u);
+        REQUIRE(cntgs::serialize(vector, stream));
+        TwoFixedAlignedAlt result;
+        REQUIRE(cntgs::deserialize(stream, result));
+        CHECK_EQ(vector, result);
+        CHECK_EQ(2, result.capacity());
+    }
+    SUBCASE("fixed and varying size")
+    {
+        OneFixedOneVaryingAligned vector{3, FLOATS1.size() * sizeof(float) + FLOATS2.size() * sizeof(float),
+                                         {FLOATS1.size()}};
+        vector.emplace_back(FLOATS1, 10u, FLOATS2.size(), FLOATS2);
+        vector.emplace_back(FLOATS1, 20u, FLOATS1.size(), FLOATS1);
+        REQUIRE(cntgs::serialize(vector, stream));
+        OneFixedOneVaryingAligned result;
+        REQUIRE(cntgs::deserialize(stream, result));
+        CHECK_EQ(2, result.size());
+        check_equal_using_get(result[0], FLOATS1, 10u, FLOATS2.size(), FLOATS2);
+        check_equal_using_get(result[1], FLOATS1, 20u, FLOATS1.size(), FLOATS1);
+        CHECK_EQ(2, result.capacity());
+        CHECK_EQ(vector.data_end() - vector.data_begin(), result.data_end() - result.data_begin());
+    }
+    SUBCASE("CoLocatedIndex")
+    {
+        using Vector = cntgs::BasicContiguousVector<cntgs::Options<cntgs::CoLocatedIndex>, uint32_t,
+                                                    cntgs::AlignAs<std::size_t, 8>, cntgs::VaryingSize<float>>;
+        Vector vector{2, FLOATS1.size() * sizeof(float) + FLOATS2.size() * sizeof(float)};
+        vector.emplace_back(10u, FLOATS1.size(), FLOATS1);
+        vector.emplace_back(20u, FLOATS2.size(), FLOATS2);
+        REQUIRE(cntgs::serialize(vector, stream));
+        Vector result;
+        REQUIRE(cntgs::deserialize(stream, result));
+        check_equal_using_get(result[0], 10u, FLOATS1.size(), FLOATS1);
+        check_equal_using_get(result[1], 20u, FLOATS2.size(), FLOATS2);
+    }
+    SUBCASE("incompatible or truncated stream")
+    {
+        OneFixed vector{1, {FLOATS1.size()}};
+        vector.emplace_back(10u, FLOATS1);
+        REQUIRE(cntgs::serialize(vector, stream));
+        const auto serialized = stream.str();
+        using Other = cntgs::ContiguousVector<float, cntgs::FixedSize<float>>;
+        Other other{1, {1}};
+        other.emplace_back(1.f, std::array{2.f});
+        CHECK_FALSE(cntgs::deserialize(stream, other));
+        CHECK_EQ(1, other.size());
+        std::stringstream truncated{serialized.substr(0, serialized.size() - 1)};
+        OneFixed result;
+        CHECK_FALSE(cntgs::deserialize(truncated, result));
+        CHECK(result.empty());
+    }
+    SUBCASE("corrupt element count or element index")
+    {
+        OneFixedOneVaryingAligned vector{2, FLOATS1.size() * sizeof(float) + FLOATS2.size() * sizeof(float),
+                                         {FLOATS1.size()}};
+        vector.emplace_back(FLOATS1, 10u, FLOATS2.size(), FLOATS2);
+        vector.emplace_back(FLOATS1, 20u, FLOATS1.size(), FLOATS1);
+        REQUIRE(cntgs::serialize(vector, stream));
+        const auto serialized = stream.str();
+        using Header = cntgs::detail::FileHeader<std::array<std::size_t, 1>>;
+        std::size_t storage_size;
+        std::size_t index_offset;
+        std::memcpy(&storage_size, serialized.data() + offsetof(Header, storage_size), sizeof(std::size_t));
+        std::memcpy(&index_offset, serialized.data() + offsetof(Header, index_offset), sizeof(std::size_t));
+        const auto check_rejected = [&](std::size_t offset, std::size_t value)
+        {
+            auto corrupt = serialized;
+            std::memcpy(corrupt.data() + offset, &value, sizeof(value));
+            std::stringstream corrupt_stream{corrupt};
+            OneFixedOneVaryingAligned result;
+            CHECK_FALSE(cntgs::deserialize(corrupt_stream, result));
+            CHECK(result.empty());
+        };
+        check_rejected(offsetof(Header, element_count), (std::numeric_limits<std::size_t>::max)());
+        check_rejected(offsetof(Header, element_count), storage_size);
+        check_rejected(index_offset, storage_size);
+        check_rejected(index_offset + sizeof(std::size_t), storage_size + 1);
+    }
+}
+
+TEST_CASE("ContiguousVector: ContiguousFileWriter")
+{
+    const auto file_path = unique_file_path("cntgs-test-file-writer");
+    const auto* const path = file_path.c_str();
+    SUBCASE("fixed size")
+    {
+        {
+            cntgs::ContiguousFileWriter<cntgs::FixedSize<cntgs::AlignAs<float, 16>>, uint32_t> writer{
+                path, {FLOATS1.size()}, 1};
+            REQUIRE(writer.is_open());
+            for (uint32_t i{}; i < 100; ++i)
+            {
+                writer.emplace_back(FLOATS1, i);
+            }
+            CHECK_EQ(100, writer.size());
+            CHECK(writer.close());
+            CHECK_FALSE(writer.is_open());
+        }
+        using Vector = cntgs::ContiguousVector<cntgs::FixedSize<cntgs::AlignAs<float, 16>>, uint32_t>;
+        std::ifstream file{path, std::ios::binary};
+        Vector result;
+        REQUIRE(cntgs::deserialize(file, result));
+        CHECK_EQ(100, result.size());
+        check_equal_using_get(result[0], FLOATS1, 0u);
+        check_equal_using_get(result[99], FLOATS1, 99u);
+    }
+    SUBCASE("fixed and varying size")
+    {
+        {
+            cntgs::ContiguousFileWriter<cntgs::FixedSize<cntgs::AlignAs<float, 16>>, uint32_t,
+                                        cntgs::AlignAs<std::size_t, 8>, cntgs::VaryingSize<cntgs::AlignAs<float, 8>>>
+                writer{path, {FLOATS1.size()}, 64};
+            for (uint32_t i{}; i < 100; ++i)
+            {
+                if (i % 2 == 0)
+                {
+                    writer.emplace_back(FLOATS1, i, FLOATS1.size(), FLOATS1);
+                }
+                else
+                {
+                    writer.emplace_back(FLOATS1, i, FLOATS2_ALT.size(), FLOATS2_ALT);
+                }
+            }
+        }
+        std::ifstream file{path, std::ios::binary};
+        OneFixedOneVaryingAligned result;
+        REQUIRE(cntgs::deserialize(file, result));
+        CHECK_EQ(100, result.size());
+        check_equal_using_get(result[0], FLOATS1, 0u, FLOATS1.size(), FLOATS1);
+        check_equal_using_get(result[51], FLOATS1, 51u, FLOATS2_ALT.size(), FLOATS2_ALT);
+        check_equal_using_get(result.back(), FLOATS1, 99u, FLOATS2_ALT.size(), FLOATS2_ALT);
+    }
+    SUBCASE("no elements")
+    {
+        CHECK(cntgs::ContiguousFileWriter<uint32_t, cntgs::VaryingSize<float>>{path}.close());
+        std::ifstream file{path, std::ios::binary};
+        cntgs::ContiguousVector<uint32_t, cntgs::VaryingSize<float>> result;
+        REQUIRE(cntgs::deserialize(file, result));
+        CHECK(result.empty());
+    }
+#ifdef __cpp_exceptions
+    SUBCASE("element storage exceeds the IndexType")
+    {
+        using Vector = cntgs::BasicContiguousVector<cntgs::Options<cntgs::IndexType<uint8_t>>, uint32_t,
+                                                    cntgs::VaryingSize<float>>;
+        cntgs::BasicContiguousFileWriter<cntgs::Options<cntgs::IndexType<uint8_t>>, uint32_t, cntgs::VaryingSize<float>>
+            writer{path};
+        uint32_t written{};
+        try
+        {
+            for (; written < 100; ++written)
+            {
+                writer.emplace_back(written, FLOATS1);
+            }
+        }
+        catch (const std::length_error&)
+        {
+        }
+        CHECK_LT(written, 100);
+        CHECK_EQ(written, writer.size());
+        REQUIRE(writer.close());
+        std::ifstream file{path, std::ios::binary};
+        Vector result;
+        REQUIRE(cntgs::deserialize(file, result));
+        CHECK_EQ(written, result.size());
+        check_equal_using_get(result.back(), written - 1, FLOATS1);
+    }
+#endif
+    std::remove(path);
+}
+
+TEST_CASE("ContiguousVector: ContiguousVectorView")
+{
+    SUBCASE("view of a vector")
+    {
+        OneFixedOneVaryingAligned vector{2, FLOATS1.size() * sizeof(float) + FLOATS2.size() * sizeof(float),
+                                         {FLOATS1.size()}};
+        vector.emplace_back(FLOATS1, 10u, FLOATS2.size(), FLOATS2);
+        vector.emplace_back(FLOATS1, 20u, FLOATS1.size(), FLOATS1);
+        const cntgs::ContiguousVectorView<cntgs::FixedSize<cntgs::AlignAs<float, 16>>, uint32_t,
+                                          cntgs::AlignAs<std::size_t, 8>, cntgs::VaryingSize<cntgs::AlignAs<float, 8>>>
+            view{vector};
+        CHECK_EQ(2, view.size());
+        CHECK_EQ(vector.data(), view.data());
+        CHECK_EQ(FLOATS1.size(), view.get_fixed_size<0>());
+        check_equal_using_get(view.front(), FLOATS1, 10u, FLOATS2.size(), FLOATS2);
+        check_equal_using_get(view.back(), FLOATS1, 20u, FLOATS1.size(), FLOATS1);
+        CHECK_EQ(vector[1], view[1]);
+        CHECK(std::equal(view.begin(), view.end(), vector.begin(), vector.end()));
+    }
+    SUBCASE("fixed size elements in external memory")
+    {
+        OneFixed vector{2, {FLOATS1.size()}};
+        vector.emplace_back(10u, FLOATS1);
+        vector.emplace_back(20u, FLOATS1);
+        std::vector<std::byte> memory(vector.data_begin(), vector.data_end());
+        const cntgs::ContiguousVectorView<uint32_t, cntgs::FixedSize<float>> view{memory.data(), 2, {FLOATS1.size()}};
+        CHECK_FALSE(view.empty());
+        CHECK(std::equal(view.begin(), view.end(), vector.begin(), vector.end()));
+        check_equal_using_get(view[1], 20u, FLOATS1);
+        CHECK_EQ(2, std::distance(view.cbegin(), view.cend()));
+    }
+    SUBCASE("varying size elements with an external index")
+    {
+        OneVarying vector{2, FLOATS1.size() * sizeof(float) + FLOATS2.size() * sizeof(float)};
+        vector.emplace_back(10u, FLOATS1.size(), FLOATS1);
+        vector.emplace_back(20u, FLOATS2.size(), FLOATS2);
+        std::vector<std::byte> memory(vector.data_begin(), vector.data_end());
+        const std::array<std::size_t, 2> index{
+            static_cast<std::size_t>(vector.begin().data() - vector.data_begin()),
+            static_cast<std::size_t>(std::next(vector.begin()).data() - vector.data_begin())};
+        const cntgs::ContiguousVectorView<uint32_t, cntgs::AlignAs<std::size_t, 8>, cntgs::VaryingSize<float>> view{
+            memory.data(), index.data(), 2};
+        check_equal_using_get(view[0], 10u, FLOATS1.size(), FLOATS1);
+        check_equal_using_get(view[1], 20u, FLOATS2.size(), FLOATS2);
+        CHECK_EQ(20u, cntgs::get<0>(*std::next(view.begin())));
+    }
+    SUBCASE("empty view")
+    {
+        const cntgs::ContiguousVectorView<uint32_t, cntgs::VaryingSize<float>> view;
+        CHECK(view.empty());
+        CHECK_EQ(view.begin(), view.end());
+    }
+}
+
+#if __has_include(<sys/mman.h>)
+TEST_CASE("ContiguousVector: MmapAllocator with huge pages")
+{
+    using Options = cntgs::Options<cntgs::Allocator<cntgs::MmapAllocator<std::byte, cntgs::HugePages::EXPLICIT>>,
+                                   cntgs::GrowthFactor<2>>;
+    using Vector =
+        cntgs::BasicContiguousVector<Options, uint32_t, cntgs::AlignAs<std::size_t, 8>, cntgs::VaryingSize<float>>;
+    Vector vector{1 << 16, (1 << 16) * FLOATS1.size() * sizeof(float)};
+    for (uint32_t i{}; i < (1 << 17); ++i)
+    {
+        vector.emplace_back(i, FLOATS1.size(), FLOATS1);
+    }
+    check_equal_using_get(vector[0], 0u, FLOATS1.size(), FLOATS1);
+    check_equal_using_get(vector[(1 << 17) - 1], (1u << 17) - 1, FLOATS1.size(), FLOATS1);
+    const auto copy = vector;
+    CHECK_EQ(vector.size(), copy.size());
+    check_equal_using_get(copy[1 << 16], 1u << 16, FLOATS1.size(), FLOATS1);
+}
+
+TEST_CASE("ContiguousVector: MmapAllocator grows in place")
+{
+    cntgs::MmapAllocator<std::byte, cntgs::HugePages::NONE> allocator;
+    const auto size = std::size_t{2} << 20;
+    auto* const memory = allocator.allocate(size);
+    memory[size - 1] = std::byte{42};
+    auto* const new_memory = allocator.reallocate(memory, size, 4 * size);
+    REQUIRE(new_memory);
+    CHECK_EQ(std::byte{42}, new_memory[size - 1]);
+    CHECK_EQ(nullptr, allocator.reallocate(new_memory, 4 * size, 1));
+    allocator.deallocate(new_memory, 4 * size);
+
+    using Options = cntgs::Options<cntgs::Allocator<cntgs::MmapAllocator<std::byte>>, cntgs::GrowthFactor<2>,
+                                   cntgs::CoLocatedIndex>;
+    using Vector =
+        cntgs::BasicContiguousVector<Options, uint32_t, cntgs::AlignAs<std::size_t, 8>, cntgs::VaryingSize<float>>;
+    Vector vector{1 << 16, (1 << 16) * FLOATS2.size() * sizeof(float)};
+    for (uint32_t i{}; i < (1 << 18); ++i)
+    {
+        if (i % 2 == 0)
+        {
+            vector.emplace_back(i, FLOATS1.size(), FLOATS1);
+        }
+        else
+        {
+            vector.emplace_back(i, FLOATS2.size(), FLOATS2);
+        }
+    }
+    for (uint32_t i{}; i < (1 << 18); i += 997)
+    {
+        if (i % 2 == 0)
+        {
+            check_equal_using_get(vector[i], i, FLOATS1.size(), FLOATS1);
+        }
+        else
+        {
+            check_equal_using_get(vector[i], i, FLOATS2.size(), FLOATS2);
+        }
+    }
+    vector.reserve(1 << 19);
+    check_equal_using_get(vector[(1 << 18) - 1], (1u << 18) - 1, FLOATS2.size(), FLOATS2);
+
+    using SeparateIndexVector = cntgs::BasicContiguousVector<
+        cntgs::Options<cntgs::Allocator<cntgs::MmapAllocator<std::byte>>, cntgs::GrowthFactor<2>>, uint32_t,
+        cntgs::AlignAs<std::size_t, 8>, cntgs::VaryingSize<float>>;
+    SeparateIndexVector separate_index_vector{1 << 16, (1 << 16) * FLOATS1.size() * sizeof(float)};
+    for (uint32_t i{}; i < (1 << 18); ++i)
+    {
+        separate_index_vector.emplace_back(i, FLOATS1.size(), FLOATS1);
+    }
+    check_equal_using_get(separate_index_vector[0], 0u, FLOATS1.size(), FLOATS1);
+    check_equal_using_get(separate_index_vector[(1 << 18) - 1], (1u << 18) - 1, FLOATS1.size(), FLOATS1);
+    separate_index_vector.emplace_back(1u << 18, FLOATS1.size(), FLOATS1);
+    CHECK_EQ((std::size_t{1} << 18) + 1, separate_index_vector.size());
+}
+
+TEST_CASE("ContiguousVector: write_to_file and MappedContiguousVector")
+{
+    const auto file_path = unique_file_path("cntgs-test-mapped-vector");
+    const auto* const path = file_path.c_str();
+    SUBCASE("fixed size")
+    {
+        OneFixed vector{3, {FLOATS1.size()}};
+        vector.emplace_back(10u, FLOATS1);
+        vector.emplace_back(20u, FLOATS1);
+        REQUIRE(cntgs::write_to_file(vector, path));
+        const cntgs::MappedContiguousVector<OneFixed> mapped{path};
+        REQUIRE(mapped.is_open());
+        CHECK_EQ(2, mapped.size());
+        CHECK_EQ(FLOATS1.size(), mapped.get_fixed_size<0>());
+        check_equal_using_get(mapped[0], 10u, FLOATS1);
+        check_equal_using_get(mapped.back(), 20u, FLOATS1);
+        CHECK(std::equal(vector.begin(), vector.end(), mapped.begin(), mapped.end()));
+    }
+    SUBCASE("fixed and varying size")
+    {
+        OneFixedOneVaryingAligned vector{3, FLOATS1.size() * sizeof(float) + FLOATS2.size() * sizeof(float),
+                                         {FLOATS1.size()}};
+        vector.emplace_back(FLOATS1, 10u, FLOATS2.size(), FLOATS2);
+        vector.emplace_back(FLOATS1, 20u, FLOATS1.size(), FLOATS1);
+        REQUIRE(cntgs::write_to_file(vector, path));
+        cntgs::MappedContiguousVector<OneFixedOneVaryingAligned> mapped{path};
+        REQUIRE(mapped.is_open());
+        const auto moved{std::move(mapped)};
+        CHECK_FALSE(mapped.is_open());
+        CHECK_EQ(2, moved.size());
+        check_equal_using_get(moved.front(), FLOATS1, 10u, FLOATS2.size(), FLOATS2);
+        check_equal_using_get(moved[1], FLOATS1, 20u, FLOATS1.size(), FLOATS1);
+        CHECK_EQ(vector.data_end() - vector.data_begin(), moved.back().data_end() - moved.data());
+    }
+    SUBCASE("incompatible file")
+    {
+        OneFixed vector{1, {FLOATS1.size()}};
+        vector.emplace_back(10u, FLOATS1);
+        REQUIRE(cntgs::write_to_file(vector, path));
+        CHECK_FALSE(cntgs::MappedContiguousVector<OneFixedOneVaryingAligned>{path}.is_open());
+        CHECK_FALSE(cntgs::MappedContiguousVector<OneFixed>{"cntgs-test-does-not-exist.bin"}.is_open());
+    }
+    SUBCASE("corrupt element count or element index")
+    {
+        OneFixedOneVaryingAligned vector{2, FLOATS1.size() * sizeof(float) + FLOATS2.size() * sizeof(float),
+                                         {FLOATS1.size()}};
+        vector.emplace_back(FLOATS1, 10u, FLOATS2.size(), FLOATS2);
+        vector.emplace_back(FLOATS1, 20u, FLOATS1.size(), FLOATS1);
+        std::stringstream stream;
+        REQUIRE(cntgs::serialize(vector, stream));
+        const auto serialized = stream.str();
+        using Header = cntgs::detail::FileHeader<std::array<std::size_t, 1>>;
+        std::size_t storage_size;
+        std::size_t index_offset;
+        std::memcpy(&storage_size, serialized.data() + offsetof(Header, storage_size), sizeof(std::size_t));
+        std::memcpy(&index_offset, serialized.data() + offsetof(Header, index_offset), sizeof(std::size_t));
+        const auto check_rejected = [&](std::size_t offset, std::size_t value)
+        {
+            auto corrupt = serialized;
+            std::memcpy(corrupt.data() + offset, &value, sizeof(value));
+            std::ofstream{path, std::ios::binary | std::ios::trunc}.write(corrupt.data(), corrupt.size());
+            CHECK_FALSE(cntgs::MappedContiguousVector<OneFixedOneVaryingAligned>{path}.is_open());
+        };
+        check_rejected(offsetof(Header, element_count), (std::numeric_limits<std::size_t>::max)());
+        check_rejected(offsetof(Header, element_count), (std::numeric_limits<std::size_t>::max)() / 8 - 1);
+        check_rejected(index_offset, storage_size);
+        check_rejected(index_offset + sizeof(std::size_t), storage_size + 1);
+    }
+    std::remove(path);
+}
+
+TEST_CASE("ContiguousVector: write_to_shared_memory and MappedContiguousVector")
+{
+    const auto name = "/cntgs-test-" + std::to_string(::getpid());
+    OneFixedOneVaryingAligned vector{2, FLOATS1.size() * sizeof(float) + FLOATS2.size() * sizeof(float),
+                                     {FLOATS1.size()}};
+    vector.emplace_back(FLOATS1, 10u, FLOATS2.size(), FLOATS2);
+    vector.emplace_back(FLOATS1, 20u, FLOATS1.size(), FLOATS1);
+    REQUIRE(cntgs::write_to_shared_memory(vector, name.c_str()));
+    using Mapped = cntgs::MappedContiguousVector<OneFixedOneVaryingAligned>;
+    SUBCASE("attach twice")
+    {
+        const auto first = Mapped::open_shared_memory(name.c_str());
+        const auto second = Mapped::open_shared_memory(name.c_str());
+        REQUIRE(first.is_open());
+        REQUIRE(second.is_open());
+        CHECK_NE(first.data(), second.data());
+        check_equal_using_get(first[0], FLOATS1, 10u, FLOATS2.size(), FLOATS2);
+        check_equal_using_get(second[1], FLOATS1, 20u, FLOATS1.size(), FLOATS1);
+        CHECK(std::equal(first.begin(), first.end(), second.begin(), second.end()));
+    }
+    SUBCASE("overwrite while attached")
+    {
+        const auto attached = Mapped::open_shared_memory(name.c_str());
+        vector.pop_back();
+        REQUIRE(cntgs::write_to_shared_memory(vector, name.c_str()));
+        CHECK_EQ(2, attached.size());
+        check_equal_using_get(attached[1], FLOATS1, 20u, FLOATS1.size(), FLOATS1);
+        CHECK_EQ(1, Mapped::open_shared_memory(name.c_str()).size());
+    }
+    SUBCASE("attach before the header is written")
+    {
+        auto* const memory = cntgs::detail::write_elements_to_shared_memory(vector, name.c_str(), 0600);
+        REQUIRE(memory);
+        CHECK_FALSE(Mapped::open_shared_memory(name.c_str()).is_open());
+        cntgs::detail::publish_shared_memory(vector, memory);
+        const auto attached = Mapped::open_shared_memory(name.c_str());
+        REQUIRE(attached.is_open());
+        check_equal_using_get(attached[1], FLOATS1, 20u, FLOATS1.size(), FLOATS1);
+    }
+    SUBCASE("incompatible or removed object")
+    {
+        CHECK_FALSE(cntgs::MappedContiguousVector<OneFixed>::open_shared_memory(name.c_str()).is_open());
+        REQUIRE(cntgs::remove_shared_memory(name.c_str()));
+        CHECK_FALSE(Mapped::open_shared_memory(name.c_str()).is_open());
+    }
+    cntgs::remove_shared_memory(name.c_str());
+}
+#endif
+
+TEST_CASE("ContiguousVector: OneFixed sort")
+{
+    OneFixed vector{6, {FLOATS1.size()}};
+    const std::array keys{30u, 10u, 50u, 20u, 40u};
+    for (auto key : keys)
+    {
+        vector.emplace_back(key, key % 20u == 0u ? FLOATS1_ALT : FLOATS1);
+    }
+    const auto check_sorted = [&](std::array<uint32_t, 5> expected)
+    {
+        for (std::size_t i{}; i < vector.size(); ++i)
+        {
+            CHECK(check_equal_using_get(vector[i], expected[i], expected[i] % 20u == 0u ? FLOATS1_ALT : FLOATS1));
+        }
+    };
+    SUBCASE("ascending")
+    {
+        cntgs::sort(vector,
+                    [](const auto& element)
+                    {
+                        return cntgs::get<0>(element);
+                    });
+        check_sorted({10u, 20u, 30u, 40u, 50u});
+    }
+    SUBCASE("descending")
+    {
+        cntgs::sort(
+            vector,
+            [](const auto& element)
+            {
+                return cntgs::get<0>(element);
+            },
+            std::greater<>{});
+        check_sorted({50u, 40u, 30u, 20u, 10u});
+    }
+    CHECK_EQ(5, vector.size());
+    vector.emplace_back(60u, FLOATS1);
+    CHECK(check_equal_using_get(vector.back(), 60u, FLOATS1));
+}
+
+TEST_CASE("ContiguousVector: Plain sort")
+{
+    Plain vector{4};
+    vector.emplace_back(1u, 4.f);
+    vector.emplace_back(2u, 2.f);
+    vector.emplace_back(3u, 3.f);
+    vector.emplace_back(4u, 1.f);
+    cntgs::sort(vector,
+                [](const auto& element)
+                {
+                    return cntgs::get<1>(element);
+                });
+    CHECK(check_equal_using_get(vector[0], 4u, 1.f));
+    CHECK(check_equal_using_get(vector[1], 2u, 2.f));
+    CHECK(check_equal_using_get(vector[2], 3u, 3.f));
+    CHECK(check_equal_using_get(vector[3], 1u, 4.f));
+}
+
+TEST_CASE("ContiguousVector: sort empty and single element")
+{
+    Plain vector{1};
+    const auto projection = [](const auto& element)
+    {
+        return cntgs::get<0>(element);
+    };
+    cntgs::sort(vector, projection);
+    CHECK(vector.empty());
+    vector.emplace_back(1u, 2.f);
+    cntgs::sort(vector, projection);
+    CHECK(check_equal_using_get(vector[0], 1u, 2.f));
+}
+
+TEST_CASE("ContiguousVector: sort non-trivial types")
+{
+    SUBCASE("OneFixedUniquePtr")
+    {
+        OneFixedUniquePtr vector{3, {1}};
+        vector.emplace_back(array_one_unique_ptr(10), std::make_unique<int>(30));
+        vector.emplace_back(array_one_unique_ptr(20), std::make_unique<int>(10));
+        vector.emplace_back(array_one_unique_ptr(30), std::make_unique<int>(20));
+        cntgs::sort(vector,
+                    [](const auto& element)
+                    {
+                        return *cntgs::get<1>(element);
+                    });
+        CHECK(check_equal_using_get(vector[0], array_one_unique_ptr(20), 10));
+        CHECK(check_equal_using_get(vector[1], array_one_unique_ptr(30), 20));
+        CHECK(check_equal_using_get(vector[2], array_one_unique_ptr(10), 30));
+    }
+    SUBCASE("FixedSize std::string")
+    {
+        cntgs::ContiguousVector<cntgs::FixedSize<std::string>, std::string> vector{3, {1}};
+        vector.emplace_back(std::array{STRING2}, STRING2);
+        vector.emplace_back(std::array{STRING1}, STRING1);
+        vector.emplace_back(std::array{STRING2}, STRING1);
+        cntgs::sort(vector,
+                    [](const auto& element)
+                    {
+                        return cntgs::get<1>(element);
+                    });
+        CHECK_EQ(STRING1, cntgs::get<1>(vector[0]));
+        CHECK_EQ(STRING1, cntgs::get<1>(vector[1]));
+        CHECK(check_equal_using_get(vector[2], std::array{STRING2}, STRING2));
+    }
+}
 }  // namespace test_vector